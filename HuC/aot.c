@@ -0,0 +1,623 @@
+#incbin(adb4d49ec7858c48e6e53f75152e12d9c,"aot/adb4d49ec7858c48e6e53f75152e12d9c.bin");
+#define adb4d49ec7858c48e6e53f75152e12d9c_SIZE 464
+#incbin(a121929a5c51027b328e4d48ea2443d4f,"aot/a121929a5c51027b328e4d48ea2443d4f.bin");
+#define a121929a5c51027b328e4d48ea2443d4f_SIZE 464
+#incbin(aceea36d06d30db1d3612101d60ad647e,"aot/aceea36d06d30db1d3612101d60ad647e.bin");
+#define aceea36d06d30db1d3612101d60ad647e_SIZE 431
+#incbin(a54118ed33b4e838063109b752c1195e6,"aot/a54118ed33b4e838063109b752c1195e6.bin");
+#define a54118ed33b4e838063109b752c1195e6_SIZE 472
+#incbin(a90e97df39d3251cc9bd13c7cb8849dc3,"aot/a90e97df39d3251cc9bd13c7cb8849dc3.bin");
+#define a90e97df39d3251cc9bd13c7cb8849dc3_SIZE 479
+#incbin(a1651e505804fe50983fe159969716b03,"aot/a1651e505804fe50983fe159969716b03.bin");
+#define a1651e505804fe50983fe159969716b03_SIZE 469
+#incbin(a64a9b946da03769654d654ac336d803c,"aot/a64a9b946da03769654d654ac336d803c.bin");
+#define a64a9b946da03769654d654ac336d803c_SIZE 51
+#incbin(aec66976367949e83c0986e3074b48c30,"aot/aec66976367949e83c0986e3074b48c30.bin");
+#define aec66976367949e83c0986e3074b48c30_SIZE 468
+#incbin(aaa83bfe2927d4ce0391451eba6aabcc5,"aot/aaa83bfe2927d4ce0391451eba6aabcc5.bin");
+#define aaa83bfe2927d4ce0391451eba6aabcc5_SIZE 459
+#incbin(a37148ebee84608aae3632d6ba2f1b992,"aot/a37148ebee84608aae3632d6ba2f1b992.bin");
+#define a37148ebee84608aae3632d6ba2f1b992_SIZE 461
+#incbin(a06936475354806f5091f14b0c1d6238f,"aot/a06936475354806f5091f14b0c1d6238f.bin");
+#define a06936475354806f5091f14b0c1d6238f_SIZE 478
+#incbin(a7ccb3832ab0fd95ac230374670c8f328,"aot/a7ccb3832ab0fd95ac230374670c8f328.bin");
+#define a7ccb3832ab0fd95ac230374670c8f328_SIZE 465
+#incbin(aa11ff7d17459b7af7be40170049b69a9,"aot/aa11ff7d17459b7af7be40170049b69a9.bin");
+#define aa11ff7d17459b7af7be40170049b69a9_SIZE 466
+#incbin(a04529559f7f02bde2b0465b47937202d,"aot/a04529559f7f02bde2b0465b47937202d.bin");
+#define a04529559f7f02bde2b0465b47937202d_SIZE 465
+#incbin(a0c12170680608b29786c8968771b9ef4,"aot/a0c12170680608b29786c8968771b9ef4.bin");
+#define a0c12170680608b29786c8968771b9ef4_SIZE 466
+#incbin(ab94c96bb2310a897421b5a1002abe84a,"aot/ab94c96bb2310a897421b5a1002abe84a.bin");
+#define ab94c96bb2310a897421b5a1002abe84a_SIZE 466
+#incbin(a1e8b2516fdcbb457e365167b8b060b47,"aot/a1e8b2516fdcbb457e365167b8b060b47.bin");
+#define a1e8b2516fdcbb457e365167b8b060b47_SIZE 468
+#incbin(a77d3a465a55c4f3b3e43abe2903e771e,"aot/a77d3a465a55c4f3b3e43abe2903e771e.bin");
+#define a77d3a465a55c4f3b3e43abe2903e771e_SIZE 464
+#incbin(a2f568e1251d168b321be413385b118ee,"aot/a2f568e1251d168b321be413385b118ee.bin");
+#define a2f568e1251d168b321be413385b118ee_SIZE 26
+#incbin(ade21813e8c937e203b3a5844d0294402,"aot/ade21813e8c937e203b3a5844d0294402.bin");
+#define ade21813e8c937e203b3a5844d0294402_SIZE 92
+#incbin(a4de0461e0d9c06474b64c46099718ac6,"aot/a4de0461e0d9c06474b64c46099718ac6.bin");
+#define a4de0461e0d9c06474b64c46099718ac6_SIZE 26
+#incbin(ae5c8e9ca8286266329eba082a82bde0e,"aot/ae5c8e9ca8286266329eba082a82bde0e.bin");
+#define ae5c8e9ca8286266329eba082a82bde0e_SIZE 362
+#incbin(a4f7b1bf2434b6aedbcc5e2b2a2913b62,"aot/a4f7b1bf2434b6aedbcc5e2b2a2913b62.bin");
+#define a4f7b1bf2434b6aedbcc5e2b2a2913b62_SIZE 464
+#incbin(a5e160f286d03498bceffe4f8f03602c7,"aot/a5e160f286d03498bceffe4f8f03602c7.bin");
+#define a5e160f286d03498bceffe4f8f03602c7_SIZE 427
+#incbin(ac14f1078661a0dc202f63e92755ee8f9,"aot/ac14f1078661a0dc202f63e92755ee8f9.bin");
+#define ac14f1078661a0dc202f63e92755ee8f9_SIZE 468
+#incbin(a2981e34060939ea5a373c72159902609,"aot/a2981e34060939ea5a373c72159902609.bin");
+#define a2981e34060939ea5a373c72159902609_SIZE 432
+#incbin(aacffb8f11b6ab3d2fed2120680dc012c,"aot/aacffb8f11b6ab3d2fed2120680dc012c.bin");
+#define aacffb8f11b6ab3d2fed2120680dc012c_SIZE 451
+#incbin(ab368d7f177985bbe50c6e6c991357b97,"aot/ab368d7f177985bbe50c6e6c991357b97.bin");
+#define ab368d7f177985bbe50c6e6c991357b97_SIZE 487
+#incbin(ad7778d0c64b6ba21494c97f77a66885a,"aot/ad7778d0c64b6ba21494c97f77a66885a.bin");
+#define ad7778d0c64b6ba21494c97f77a66885a_SIZE 281
+#incbin(a83382d51227a540180744b53aac05f4a,"aot/a83382d51227a540180744b53aac05f4a.bin");
+#define a83382d51227a540180744b53aac05f4a_SIZE 113
+#incbin(a4d4aa556864d162b0aeb1b369c4c3818,"aot/a4d4aa556864d162b0aeb1b369c4c3818.bin");
+#define a4d4aa556864d162b0aeb1b369c4c3818_SIZE 458
+#incbin(a032296ac7ab7f2ebf1287e9373f34b8c,"aot/a032296ac7ab7f2ebf1287e9373f34b8c.bin");
+#define a032296ac7ab7f2ebf1287e9373f34b8c_SIZE 458
+#incbin(a7f967b396337c0be9889ee08e6d74417,"aot/a7f967b396337c0be9889ee08e6d74417.bin");
+#define a7f967b396337c0be9889ee08e6d74417_SIZE 460
+#incbin(ac57090f3959e012ae4266ea7d0e606d9,"aot/ac57090f3959e012ae4266ea7d0e606d9.bin");
+#define ac57090f3959e012ae4266ea7d0e606d9_SIZE 460
+#incbin(a27b0e5657959723224fd4c0346a9dcc5,"aot/a27b0e5657959723224fd4c0346a9dcc5.bin");
+#define a27b0e5657959723224fd4c0346a9dcc5_SIZE 460
+#incbin(a31a4bb69cf907ec19ae5d76b4520bc6c,"aot/a31a4bb69cf907ec19ae5d76b4520bc6c.bin");
+#define a31a4bb69cf907ec19ae5d76b4520bc6c_SIZE 482
+#incbin(a1edf946c1da94c88f2aacea7f79acef2,"aot/a1edf946c1da94c88f2aacea7f79acef2.bin");
+#define a1edf946c1da94c88f2aacea7f79acef2_SIZE 168
+#incbin(a80a07527ed5711471e1ae64cbb7c3ab7,"aot/a80a07527ed5711471e1ae64cbb7c3ab7.bin");
+#define a80a07527ed5711471e1ae64cbb7c3ab7_SIZE 413
+#incbin(a745093bfb9f69435244c87c6bfb16025,"aot/a745093bfb9f69435244c87c6bfb16025.bin");
+#define a745093bfb9f69435244c87c6bfb16025_SIZE 180
+#incbin(a41bd61e268fedccfb0d91dd571dd28b2,"aot/a41bd61e268fedccfb0d91dd571dd28b2.bin");
+#define a41bd61e268fedccfb0d91dd571dd28b2_SIZE 479
+#incbin(a63d5fcee234cbe1825619074e95ed0d7,"aot/a63d5fcee234cbe1825619074e95ed0d7.bin");
+#define a63d5fcee234cbe1825619074e95ed0d7_SIZE 465
+#incbin(a2636e021b501d8c92600c7f3311f6af2,"aot/a2636e021b501d8c92600c7f3311f6af2.bin");
+#define a2636e021b501d8c92600c7f3311f6af2_SIZE 485
+#incbin(a0646dc377b77c4dea8dcc12c2e133ece,"aot/a0646dc377b77c4dea8dcc12c2e133ece.bin");
+#define a0646dc377b77c4dea8dcc12c2e133ece_SIZE 472
+#incbin(aad8e1425a9f996d8f46b49c310c87f74,"aot/aad8e1425a9f996d8f46b49c310c87f74.bin");
+#define aad8e1425a9f996d8f46b49c310c87f74_SIZE 199
+#incbin(ababfca0e8b27cb57204cb7d5e38e3aa7,"aot/ababfca0e8b27cb57204cb7d5e38e3aa7.bin");
+#define ababfca0e8b27cb57204cb7d5e38e3aa7_SIZE 199
+#incbin(acf21ad502955e1129230534880262acd,"aot/acf21ad502955e1129230534880262acd.bin");
+#define acf21ad502955e1129230534880262acd_SIZE 458
+#incbin(aaf6c221b345a0fc40ee8b93af064a3a7,"aot/aaf6c221b345a0fc40ee8b93af064a3a7.bin");
+#define aaf6c221b345a0fc40ee8b93af064a3a7_SIZE 82
+#incbin(a0f3f67e4a73d987e499a46d866503283,"aot/a0f3f67e4a73d987e499a46d866503283.bin");
+#define a0f3f67e4a73d987e499a46d866503283_SIZE 463
+#incbin(ad2815a5f9eae59ae6a0c702c6712807e,"aot/ad2815a5f9eae59ae6a0c702c6712807e.bin");
+#define ad2815a5f9eae59ae6a0c702c6712807e_SIZE 466
+#incbin(aad3e107c21cd2587aa3281146fafb1fe,"aot/aad3e107c21cd2587aa3281146fafb1fe.bin");
+#define aad3e107c21cd2587aa3281146fafb1fe_SIZE 471
+#incbin(ab2a62f980dc933b0c79a83dfa63e765e,"aot/ab2a62f980dc933b0c79a83dfa63e765e.bin");
+#define ab2a62f980dc933b0c79a83dfa63e765e_SIZE 469
+#incbin(a8e3fd2280b28c7f2750614c97b99184a,"aot/a8e3fd2280b28c7f2750614c97b99184a.bin");
+#define a8e3fd2280b28c7f2750614c97b99184a_SIZE 454
+#incbin(ada6cfd51656aa1795efd8cf64730d554,"aot/ada6cfd51656aa1795efd8cf64730d554.bin");
+#define ada6cfd51656aa1795efd8cf64730d554_SIZE 95
+#incbin(ae32491f53e6c41eece664b7a7983d1c2,"aot/ae32491f53e6c41eece664b7a7983d1c2.bin");
+#define ae32491f53e6c41eece664b7a7983d1c2_SIZE 458
+#incbin(a1768951e5526bf3adc516f15ad24cf3c,"aot/a1768951e5526bf3adc516f15ad24cf3c.bin");
+#define a1768951e5526bf3adc516f15ad24cf3c_SIZE 465
+#incbin(a3fef024dcf670a95165877e59d27d6ef,"aot/a3fef024dcf670a95165877e59d27d6ef.bin");
+#define a3fef024dcf670a95165877e59d27d6ef_SIZE 465
+#incbin(ae895deff3aa743b499a12ca32e99e0a7,"aot/ae895deff3aa743b499a12ca32e99e0a7.bin");
+#define ae895deff3aa743b499a12ca32e99e0a7_SIZE 458
+#incbin(a28547d56c9b1a8bc2220eb7e1a9121b9,"aot/a28547d56c9b1a8bc2220eb7e1a9121b9.bin");
+#define a28547d56c9b1a8bc2220eb7e1a9121b9_SIZE 482
+#incbin(a2b1b78c96448cca5d0d1d3a9e2b1caed,"aot/a2b1b78c96448cca5d0d1d3a9e2b1caed.bin");
+#define a2b1b78c96448cca5d0d1d3a9e2b1caed_SIZE 416
+#incbin(aec108382dc94dca97c97186efee23d04,"aot/aec108382dc94dca97c97186efee23d04.bin");
+#define aec108382dc94dca97c97186efee23d04_SIZE 462
+#incbin(a9a46648fe7448f0f27c0c6732ee47039,"aot/a9a46648fe7448f0f27c0c6732ee47039.bin");
+#define a9a46648fe7448f0f27c0c6732ee47039_SIZE 474
+#incbin(afefd528b50ff171e044ae478c84704af,"aot/afefd528b50ff171e044ae478c84704af.bin");
+#define afefd528b50ff171e044ae478c84704af_SIZE 258
+#incbin(a127ec31cf837b4d0cdf26df23b2f09a0,"aot/a127ec31cf837b4d0cdf26df23b2f09a0.bin");
+#define a127ec31cf837b4d0cdf26df23b2f09a0_SIZE 467
+#incbin(a5d7c3196ca1703f196c10013f492e38c,"aot/a5d7c3196ca1703f196c10013f492e38c.bin");
+#define a5d7c3196ca1703f196c10013f492e38c_SIZE 487
+#incbin(ae8673bfa2e4100781cae921f8905343a,"aot/ae8673bfa2e4100781cae921f8905343a.bin");
+#define ae8673bfa2e4100781cae921f8905343a_SIZE 487
+#incbin(afd0de470fb41fa3d0b33e7064bbdc769,"aot/afd0de470fb41fa3d0b33e7064bbdc769.bin");
+#define afd0de470fb41fa3d0b33e7064bbdc769_SIZE 88
+#incbin(a5e6a062995822935f0ef4666e3f33f58,"aot/a5e6a062995822935f0ef4666e3f33f58.bin");
+#define a5e6a062995822935f0ef4666e3f33f58_SIZE 161
+#incbin(a3ebbceec3656acb7a178f8286c65fb9b,"aot/a3ebbceec3656acb7a178f8286c65fb9b.bin");
+#define a3ebbceec3656acb7a178f8286c65fb9b_SIZE 466
+#incbin(ac5040b8d5b19907cdd25640122f99cea,"aot/ac5040b8d5b19907cdd25640122f99cea.bin");
+#define ac5040b8d5b19907cdd25640122f99cea_SIZE 467
+#incbin(a75f393921ba59caca4768e59945c1838,"aot/a75f393921ba59caca4768e59945c1838.bin");
+#define a75f393921ba59caca4768e59945c1838_SIZE 475
+#incbin(a87ba7632444df1444f8900a26701ff30,"aot/a87ba7632444df1444f8900a26701ff30.bin");
+#define a87ba7632444df1444f8900a26701ff30_SIZE 475
+#incbin(a7d94954824720b465083be3799fa2678,"aot/a7d94954824720b465083be3799fa2678.bin");
+#define a7d94954824720b465083be3799fa2678_SIZE 472
+#incbin(a871d17bd2733a95c351a87fd39f40bc1,"aot/a871d17bd2733a95c351a87fd39f40bc1.bin");
+#define a871d17bd2733a95c351a87fd39f40bc1_SIZE 468
+#incbin(aca6978f5e3ee2e7f8680322ab7df913a,"aot/aca6978f5e3ee2e7f8680322ab7df913a.bin");
+#define aca6978f5e3ee2e7f8680322ab7df913a_SIZE 498
+#incbin(a119b1b4777ff8f4ac6683787b8e182c4,"aot/a119b1b4777ff8f4ac6683787b8e182c4.bin");
+#define a119b1b4777ff8f4ac6683787b8e182c4_SIZE 462
+#incbin(a239d280f57c81c39796364b927966047,"aot/a239d280f57c81c39796364b927966047.bin");
+#define a239d280f57c81c39796364b927966047_SIZE 469
+#incbin(ac8908a6478d9603bf763370ec10fadb8,"aot/ac8908a6478d9603bf763370ec10fadb8.bin");
+#define ac8908a6478d9603bf763370ec10fadb8_SIZE 469
+#incbin(a136dca921f7e6d2cdd601f014b90a093,"aot/a136dca921f7e6d2cdd601f014b90a093.bin");
+#define a136dca921f7e6d2cdd601f014b90a093_SIZE 398
+#incbin(a9685163845de7d44e6a31fa3a0653437,"aot/a9685163845de7d44e6a31fa3a0653437.bin");
+#define a9685163845de7d44e6a31fa3a0653437_SIZE 466
+#incbin(a09b5b779ce6acd83c0dced0f64739fd4,"aot/a09b5b779ce6acd83c0dced0f64739fd4.bin");
+#define a09b5b779ce6acd83c0dced0f64739fd4_SIZE 478
+#incbin(aa6275f7c4f5b36324fb9c6e35934b5ed,"aot/aa6275f7c4f5b36324fb9c6e35934b5ed.bin");
+#define aa6275f7c4f5b36324fb9c6e35934b5ed_SIZE 471
+#incbin(a1cef3a1bf3980b6faa97e07f124357d2,"aot/a1cef3a1bf3980b6faa97e07f124357d2.bin");
+#define a1cef3a1bf3980b6faa97e07f124357d2_SIZE 481
+#incbin(a524f7d91738b8143194bd4c702898a6a,"aot/a524f7d91738b8143194bd4c702898a6a.bin");
+#define a524f7d91738b8143194bd4c702898a6a_SIZE 490
+#incbin(ae4419464d570c4b497ba1979e790b104,"aot/ae4419464d570c4b497ba1979e790b104.bin");
+#define ae4419464d570c4b497ba1979e790b104_SIZE 457
+#incbin(aa212441eb83ac1231279219dda4c1ae6,"aot/aa212441eb83ac1231279219dda4c1ae6.bin");
+#define aa212441eb83ac1231279219dda4c1ae6_SIZE 476
+#incbin(a834ec731b589e8fd5ed8f04e5db1c74b,"aot/a834ec731b589e8fd5ed8f04e5db1c74b.bin");
+#define a834ec731b589e8fd5ed8f04e5db1c74b_SIZE 470
+#incbin(ae0937501feb6b5a85393805ba9fd0f85,"aot/ae0937501feb6b5a85393805ba9fd0f85.bin");
+#define ae0937501feb6b5a85393805ba9fd0f85_SIZE 473
+#incbin(abb32b6bf6306f0d322e01086d47941b7,"aot/abb32b6bf6306f0d322e01086d47941b7.bin");
+#define abb32b6bf6306f0d322e01086d47941b7_SIZE 481
+#incbin(af7a7798118ee9eedc779f4f0cab1b696,"aot/af7a7798118ee9eedc779f4f0cab1b696.bin");
+#define af7a7798118ee9eedc779f4f0cab1b696_SIZE 452
+#incbin(a8f60c9900e3f8ac422104c5414e4ec8f,"aot/a8f60c9900e3f8ac422104c5414e4ec8f.bin");
+#define a8f60c9900e3f8ac422104c5414e4ec8f_SIZE 476
+#incbin(a5586f139496777c48581cb6f297d44ff,"aot/a5586f139496777c48581cb6f297d44ff.bin");
+#define a5586f139496777c48581cb6f297d44ff_SIZE 469
+#incbin(a054f16051aba431c1af78002eb60429f,"aot/a054f16051aba431c1af78002eb60429f.bin");
+#define a054f16051aba431c1af78002eb60429f_SIZE 467
+#incbin(af8721af216024d64a300612c107c1639,"aot/af8721af216024d64a300612c107c1639.bin");
+#define af8721af216024d64a300612c107c1639_SIZE 473
+#incbin(a27fd680406cb8171f3b168ae4ac417b9,"aot/a27fd680406cb8171f3b168ae4ac417b9.bin");
+#define a27fd680406cb8171f3b168ae4ac417b9_SIZE 465
+#incbin(a90a94ceab2da22e65d9b82daedd0f10a,"aot/a90a94ceab2da22e65d9b82daedd0f10a.bin");
+#define a90a94ceab2da22e65d9b82daedd0f10a_SIZE 465
+#incbin(a8c18d3074079aed6c34bb5c3c93e3510,"aot/a8c18d3074079aed6c34bb5c3c93e3510.bin");
+#define a8c18d3074079aed6c34bb5c3c93e3510_SIZE 478
+#incbin(a4be01313202c374dbce1fa30458f7473,"aot/a4be01313202c374dbce1fa30458f7473.bin");
+#define a4be01313202c374dbce1fa30458f7473_SIZE 153
+#incbin(a5605ca30fdb603ff5096a38e0ec75833,"aot/a5605ca30fdb603ff5096a38e0ec75833.bin");
+#define a5605ca30fdb603ff5096a38e0ec75833_SIZE 432
+#incbin(ad0bf48f2ccaa82c32426e7ab8037c792,"aot/ad0bf48f2ccaa82c32426e7ab8037c792.bin");
+#define ad0bf48f2ccaa82c32426e7ab8037c792_SIZE 448
+#incbin(a9f1197a0bbf6026fc4526079b37725bb,"aot/a9f1197a0bbf6026fc4526079b37725bb.bin");
+#define a9f1197a0bbf6026fc4526079b37725bb_SIZE 461
+#incbin(a95934e80031e6d027700bf7022169312,"aot/a95934e80031e6d027700bf7022169312.bin");
+#define a95934e80031e6d027700bf7022169312_SIZE 465
+#incbin(a080dc67c4202725e05c5204c74e1213e,"aot/a080dc67c4202725e05c5204c74e1213e.bin");
+#define a080dc67c4202725e05c5204c74e1213e_SIZE 459
+#incbin(a82e107c36c5150f1a24a6d7264cc631f,"aot/a82e107c36c5150f1a24a6d7264cc631f.bin");
+#define a82e107c36c5150f1a24a6d7264cc631f_SIZE 322
+#incbin(af07cd09f69c6da71324d330848c29a92,"aot/af07cd09f69c6da71324d330848c29a92.bin");
+#define af07cd09f69c6da71324d330848c29a92_SIZE 444
+#incbin(aa519beea791acca93c905914528174b2,"aot/aa519beea791acca93c905914528174b2.bin");
+#define aa519beea791acca93c905914528174b2_SIZE 444
+#incbin(a8b43722e08551dd327ad236c54b690fb,"aot/a8b43722e08551dd327ad236c54b690fb.bin");
+#define a8b43722e08551dd327ad236c54b690fb_SIZE 464
+#incbin(a87fa21746e95d6087b825b6bdf94a9a4,"aot/a87fa21746e95d6087b825b6bdf94a9a4.bin");
+#define a87fa21746e95d6087b825b6bdf94a9a4_SIZE 473
+#incbin(a7129855e51ff4fe92d51fb969f0e06e6,"aot/a7129855e51ff4fe92d51fb969f0e06e6.bin");
+#define a7129855e51ff4fe92d51fb969f0e06e6_SIZE 475
+#incbin(a7cf08ff16d9d0e12060e701d7d313f00,"aot/a7cf08ff16d9d0e12060e701d7d313f00.bin");
+#define a7cf08ff16d9d0e12060e701d7d313f00_SIZE 254
+#incbin(ab02f398a7bfb3a3024f5098f1acfbd1b,"aot/ab02f398a7bfb3a3024f5098f1acfbd1b.bin");
+#define ab02f398a7bfb3a3024f5098f1acfbd1b_SIZE 472
+#incbin(a9f7001bbb395401d6b4d8c2f6618046e,"aot/a9f7001bbb395401d6b4d8c2f6618046e.bin");
+#define a9f7001bbb395401d6b4d8c2f6618046e_SIZE 479
+#incbin(a109bb19a7dd1186c086cb85a3f4059d3,"aot/a109bb19a7dd1186c086cb85a3f4059d3.bin");
+#define a109bb19a7dd1186c086cb85a3f4059d3_SIZE 457
+#incbin(a09919bb973d2ef4558b2599d6f5890ee,"aot/a09919bb973d2ef4558b2599d6f5890ee.bin");
+#define a09919bb973d2ef4558b2599d6f5890ee_SIZE 479
+#incbin(a2e1b88e1f2c9bd9abd9675aad9121dfc,"aot/a2e1b88e1f2c9bd9abd9675aad9121dfc.bin");
+#define a2e1b88e1f2c9bd9abd9675aad9121dfc_SIZE 66
+#incbin(a725c98df9c7abd282d51b0a95914a32f,"aot/a725c98df9c7abd282d51b0a95914a32f.bin");
+#define a725c98df9c7abd282d51b0a95914a32f_SIZE 450
+#incbin(a6bee54868d34cff91e9045f81731dc83,"aot/a6bee54868d34cff91e9045f81731dc83.bin");
+#define a6bee54868d34cff91e9045f81731dc83_SIZE 476
+#incbin(a3ef726d7b7a4d148ef8d62cff1c84985,"aot/a3ef726d7b7a4d148ef8d62cff1c84985.bin");
+#define a3ef726d7b7a4d148ef8d62cff1c84985_SIZE 476
+#incbin(a6743226bdb64644dea5040b82ecdf2ec,"aot/a6743226bdb64644dea5040b82ecdf2ec.bin");
+#define a6743226bdb64644dea5040b82ecdf2ec_SIZE 490
+#incbin(a63dca0e0d8c9b6e74dc1ff303d49839a,"aot/a63dca0e0d8c9b6e74dc1ff303d49839a.bin");
+#define a63dca0e0d8c9b6e74dc1ff303d49839a_SIZE 469
+#incbin(a58d311daaa137c6aea259bcac0b028a6,"aot/a58d311daaa137c6aea259bcac0b028a6.bin");
+#define a58d311daaa137c6aea259bcac0b028a6_SIZE 466
+#incbin(aa90bcb03cac5e6e463c2031febb019a2,"aot/aa90bcb03cac5e6e463c2031febb019a2.bin");
+#define aa90bcb03cac5e6e463c2031febb019a2_SIZE 478
+#incbin(ad910ed653540b5df17c797e114fc299e,"aot/ad910ed653540b5df17c797e114fc299e.bin");
+#define ad910ed653540b5df17c797e114fc299e_SIZE 461
+
+int
+chip8_load_aot(int rom)
+{
+  switch(rom)
+  {
+  case 0:
+    fmemcpy(&jit_buf[JIT_SIZE - adb4d49ec7858c48e6e53f75152e12d9c_SIZE],adb4d49ec7858c48e6e53f75152e12d9c,adb4d49ec7858c48e6e53f75152e12d9c_SIZE);
+    return adb4d49ec7858c48e6e53f75152e12d9c_SIZE;
+  case 1:
+    fmemcpy(&jit_buf[JIT_SIZE - a121929a5c51027b328e4d48ea2443d4f_SIZE],a121929a5c51027b328e4d48ea2443d4f,a121929a5c51027b328e4d48ea2443d4f_SIZE);
+    return a121929a5c51027b328e4d48ea2443d4f_SIZE;
+  case 2:
+    fmemcpy(&jit_buf[JIT_SIZE - aceea36d06d30db1d3612101d60ad647e_SIZE],aceea36d06d30db1d3612101d60ad647e,aceea36d06d30db1d3612101d60ad647e_SIZE);
+    return aceea36d06d30db1d3612101d60ad647e_SIZE;
+  case 3:
+    fmemcpy(&jit_buf[JIT_SIZE - a54118ed33b4e838063109b752c1195e6_SIZE],a54118ed33b4e838063109b752c1195e6,a54118ed33b4e838063109b752c1195e6_SIZE);
+    return a54118ed33b4e838063109b752c1195e6_SIZE;
+  case 4:
+    fmemcpy(&jit_buf[JIT_SIZE - a90e97df39d3251cc9bd13c7cb8849dc3_SIZE],a90e97df39d3251cc9bd13c7cb8849dc3,a90e97df39d3251cc9bd13c7cb8849dc3_SIZE);
+    return a90e97df39d3251cc9bd13c7cb8849dc3_SIZE;
+  case 5:
+    fmemcpy(&jit_buf[JIT_SIZE - a1651e505804fe50983fe159969716b03_SIZE],a1651e505804fe50983fe159969716b03,a1651e505804fe50983fe159969716b03_SIZE);
+    return a1651e505804fe50983fe159969716b03_SIZE;
+  case 6:
+    fmemcpy(&jit_buf[JIT_SIZE - a64a9b946da03769654d654ac336d803c_SIZE],a64a9b946da03769654d654ac336d803c,a64a9b946da03769654d654ac336d803c_SIZE);
+    return a64a9b946da03769654d654ac336d803c_SIZE;
+  case 7:
+    fmemcpy(&jit_buf[JIT_SIZE - aec66976367949e83c0986e3074b48c30_SIZE],aec66976367949e83c0986e3074b48c30,aec66976367949e83c0986e3074b48c30_SIZE);
+    return aec66976367949e83c0986e3074b48c30_SIZE;
+  case 9:
+    fmemcpy(&jit_buf[JIT_SIZE - aaa83bfe2927d4ce0391451eba6aabcc5_SIZE],aaa83bfe2927d4ce0391451eba6aabcc5,aaa83bfe2927d4ce0391451eba6aabcc5_SIZE);
+    return aaa83bfe2927d4ce0391451eba6aabcc5_SIZE;
+  case 10:
+    fmemcpy(&jit_buf[JIT_SIZE - a37148ebee84608aae3632d6ba2f1b992_SIZE],a37148ebee84608aae3632d6ba2f1b992,a37148ebee84608aae3632d6ba2f1b992_SIZE);
+    return a37148ebee84608aae3632d6ba2f1b992_SIZE;
+  case 11:
+    fmemcpy(&jit_buf[JIT_SIZE - a06936475354806f5091f14b0c1d6238f_SIZE],a06936475354806f5091f14b0c1d6238f,a06936475354806f5091f14b0c1d6238f_SIZE);
+    return a06936475354806f5091f14b0c1d6238f_SIZE;
+  case 12:
+    fmemcpy(&jit_buf[JIT_SIZE - a7ccb3832ab0fd95ac230374670c8f328_SIZE],a7ccb3832ab0fd95ac230374670c8f328,a7ccb3832ab0fd95ac230374670c8f328_SIZE);
+    return a7ccb3832ab0fd95ac230374670c8f328_SIZE;
+  case 13:
+    fmemcpy(&jit_buf[JIT_SIZE - aa11ff7d17459b7af7be40170049b69a9_SIZE],aa11ff7d17459b7af7be40170049b69a9,aa11ff7d17459b7af7be40170049b69a9_SIZE);
+    return aa11ff7d17459b7af7be40170049b69a9_SIZE;
+  case 14:
+    fmemcpy(&jit_buf[JIT_SIZE - a04529559f7f02bde2b0465b47937202d_SIZE],a04529559f7f02bde2b0465b47937202d,a04529559f7f02bde2b0465b47937202d_SIZE);
+    return a04529559f7f02bde2b0465b47937202d_SIZE;
+  case 15:
+    fmemcpy(&jit_buf[JIT_SIZE - a0c12170680608b29786c8968771b9ef4_SIZE],a0c12170680608b29786c8968771b9ef4,a0c12170680608b29786c8968771b9ef4_SIZE);
+    return a0c12170680608b29786c8968771b9ef4_SIZE;
+  case 16:
+    fmemcpy(&jit_buf[JIT_SIZE - ab94c96bb2310a897421b5a1002abe84a_SIZE],ab94c96bb2310a897421b5a1002abe84a,ab94c96bb2310a897421b5a1002abe84a_SIZE);
+    return ab94c96bb2310a897421b5a1002abe84a_SIZE;
+  case 17:
+    fmemcpy(&jit_buf[JIT_SIZE - a1e8b2516fdcbb457e365167b8b060b47_SIZE],a1e8b2516fdcbb457e365167b8b060b47,a1e8b2516fdcbb457e365167b8b060b47_SIZE);
+    return a1e8b2516fdcbb457e365167b8b060b47_SIZE;
+  case 18:
+    fmemcpy(&jit_buf[JIT_SIZE - a77d3a465a55c4f3b3e43abe2903e771e_SIZE],a77d3a465a55c4f3b3e43abe2903e771e,a77d3a465a55c4f3b3e43abe2903e771e_SIZE);
+    return a77d3a465a55c4f3b3e43abe2903e771e_SIZE;
+  case 19:
+    fmemcpy(&jit_buf[JIT_SIZE - a2f568e1251d168b321be413385b118ee_SIZE],a2f568e1251d168b321be413385b118ee,a2f568e1251d168b321be413385b118ee_SIZE);
+    return a2f568e1251d168b321be413385b118ee_SIZE;
+  case 20:
+    fmemcpy(&jit_buf[JIT_SIZE - ade21813e8c937e203b3a5844d0294402_SIZE],ade21813e8c937e203b3a5844d0294402,ade21813e8c937e203b3a5844d0294402_SIZE);
+    return ade21813e8c937e203b3a5844d0294402_SIZE;
+  case 21:
+    fmemcpy(&jit_buf[JIT_SIZE - a4de0461e0d9c06474b64c46099718ac6_SIZE],a4de0461e0d9c06474b64c46099718ac6,a4de0461e0d9c06474b64c46099718ac6_SIZE);
+    return a4de0461e0d9c06474b64c46099718ac6_SIZE;
+  case 22:
+    fmemcpy(&jit_buf[JIT_SIZE - ae5c8e9ca8286266329eba082a82bde0e_SIZE],ae5c8e9ca8286266329eba082a82bde0e,ae5c8e9ca8286266329eba082a82bde0e_SIZE);
+    return ae5c8e9ca8286266329eba082a82bde0e_SIZE;
+  case 23:
+    fmemcpy(&jit_buf[JIT_SIZE - a4f7b1bf2434b6aedbcc5e2b2a2913b62_SIZE],a4f7b1bf2434b6aedbcc5e2b2a2913b62,a4f7b1bf2434b6aedbcc5e2b2a2913b62_SIZE);
+    return a4f7b1bf2434b6aedbcc5e2b2a2913b62_SIZE;
+  case 24:
+    fmemcpy(&jit_buf[JIT_SIZE - a5e160f286d03498bceffe4f8f03602c7_SIZE],a5e160f286d03498bceffe4f8f03602c7,a5e160f286d03498bceffe4f8f03602c7_SIZE);
+    return a5e160f286d03498bceffe4f8f03602c7_SIZE;
+  case 25:
+    fmemcpy(&jit_buf[JIT_SIZE - ac14f1078661a0dc202f63e92755ee8f9_SIZE],ac14f1078661a0dc202f63e92755ee8f9,ac14f1078661a0dc202f63e92755ee8f9_SIZE);
+    return ac14f1078661a0dc202f63e92755ee8f9_SIZE;
+  case 26:
+    fmemcpy(&jit_buf[JIT_SIZE - a2981e34060939ea5a373c72159902609_SIZE],a2981e34060939ea5a373c72159902609,a2981e34060939ea5a373c72159902609_SIZE);
+    return a2981e34060939ea5a373c72159902609_SIZE;
+  case 27:
+    fmemcpy(&jit_buf[JIT_SIZE - aacffb8f11b6ab3d2fed2120680dc012c_SIZE],aacffb8f11b6ab3d2fed2120680dc012c,aacffb8f11b6ab3d2fed2120680dc012c_SIZE);
+    return aacffb8f11b6ab3d2fed2120680dc012c_SIZE;
+  case 28:
+    fmemcpy(&jit_buf[JIT_SIZE - ab368d7f177985bbe50c6e6c991357b97_SIZE],ab368d7f177985bbe50c6e6c991357b97,ab368d7f177985bbe50c6e6c991357b97_SIZE);
+    return ab368d7f177985bbe50c6e6c991357b97_SIZE;
+  case 29:
+    fmemcpy(&jit_buf[JIT_SIZE - ad7778d0c64b6ba21494c97f77a66885a_SIZE],ad7778d0c64b6ba21494c97f77a66885a,ad7778d0c64b6ba21494c97f77a66885a_SIZE);
+    return ad7778d0c64b6ba21494c97f77a66885a_SIZE;
+  case 30:
+    fmemcpy(&jit_buf[JIT_SIZE - a83382d51227a540180744b53aac05f4a_SIZE],a83382d51227a540180744b53aac05f4a,a83382d51227a540180744b53aac05f4a_SIZE);
+    return a83382d51227a540180744b53aac05f4a_SIZE;
+  case 31:
+    fmemcpy(&jit_buf[JIT_SIZE - a4d4aa556864d162b0aeb1b369c4c3818_SIZE],a4d4aa556864d162b0aeb1b369c4c3818,a4d4aa556864d162b0aeb1b369c4c3818_SIZE);
+    return a4d4aa556864d162b0aeb1b369c4c3818_SIZE;
+  case 32:
+    fmemcpy(&jit_buf[JIT_SIZE - a032296ac7ab7f2ebf1287e9373f34b8c_SIZE],a032296ac7ab7f2ebf1287e9373f34b8c,a032296ac7ab7f2ebf1287e9373f34b8c_SIZE);
+    return a032296ac7ab7f2ebf1287e9373f34b8c_SIZE;
+  case 33:
+    fmemcpy(&jit_buf[JIT_SIZE - a7f967b396337c0be9889ee08e6d74417_SIZE],a7f967b396337c0be9889ee08e6d74417,a7f967b396337c0be9889ee08e6d74417_SIZE);
+    return a7f967b396337c0be9889ee08e6d74417_SIZE;
+  case 34:
+    fmemcpy(&jit_buf[JIT_SIZE - ac57090f3959e012ae4266ea7d0e606d9_SIZE],ac57090f3959e012ae4266ea7d0e606d9,ac57090f3959e012ae4266ea7d0e606d9_SIZE);
+    return ac57090f3959e012ae4266ea7d0e606d9_SIZE;
+  case 35:
+    fmemcpy(&jit_buf[JIT_SIZE - a27b0e5657959723224fd4c0346a9dcc5_SIZE],a27b0e5657959723224fd4c0346a9dcc5,a27b0e5657959723224fd4c0346a9dcc5_SIZE);
+    return a27b0e5657959723224fd4c0346a9dcc5_SIZE;
+  case 36:
+    fmemcpy(&jit_buf[JIT_SIZE - a31a4bb69cf907ec19ae5d76b4520bc6c_SIZE],a31a4bb69cf907ec19ae5d76b4520bc6c,a31a4bb69cf907ec19ae5d76b4520bc6c_SIZE);
+    return a31a4bb69cf907ec19ae5d76b4520bc6c_SIZE;
+  case 38:
+    fmemcpy(&jit_buf[JIT_SIZE - a1edf946c1da94c88f2aacea7f79acef2_SIZE],a1edf946c1da94c88f2aacea7f79acef2,a1edf946c1da94c88f2aacea7f79acef2_SIZE);
+    return a1edf946c1da94c88f2aacea7f79acef2_SIZE;
+  case 39:
+    fmemcpy(&jit_buf[JIT_SIZE - a80a07527ed5711471e1ae64cbb7c3ab7_SIZE],a80a07527ed5711471e1ae64cbb7c3ab7,a80a07527ed5711471e1ae64cbb7c3ab7_SIZE);
+    return a80a07527ed5711471e1ae64cbb7c3ab7_SIZE;
+  case 40:
+    fmemcpy(&jit_buf[JIT_SIZE - a745093bfb9f69435244c87c6bfb16025_SIZE],a745093bfb9f69435244c87c6bfb16025,a745093bfb9f69435244c87c6bfb16025_SIZE);
+    return a745093bfb9f69435244c87c6bfb16025_SIZE;
+  case 41:
+    fmemcpy(&jit_buf[JIT_SIZE - a41bd61e268fedccfb0d91dd571dd28b2_SIZE],a41bd61e268fedccfb0d91dd571dd28b2,a41bd61e268fedccfb0d91dd571dd28b2_SIZE);
+    return a41bd61e268fedccfb0d91dd571dd28b2_SIZE;
+  case 42:
+    fmemcpy(&jit_buf[JIT_SIZE - a63d5fcee234cbe1825619074e95ed0d7_SIZE],a63d5fcee234cbe1825619074e95ed0d7,a63d5fcee234cbe1825619074e95ed0d7_SIZE);
+    return a63d5fcee234cbe1825619074e95ed0d7_SIZE;
+  case 43:
+    fmemcpy(&jit_buf[JIT_SIZE - a2636e021b501d8c92600c7f3311f6af2_SIZE],a2636e021b501d8c92600c7f3311f6af2,a2636e021b501d8c92600c7f3311f6af2_SIZE);
+    return a2636e021b501d8c92600c7f3311f6af2_SIZE;
+  case 44:
+    fmemcpy(&jit_buf[JIT_SIZE - a0646dc377b77c4dea8dcc12c2e133ece_SIZE],a0646dc377b77c4dea8dcc12c2e133ece,a0646dc377b77c4dea8dcc12c2e133ece_SIZE);
+    return a0646dc377b77c4dea8dcc12c2e133ece_SIZE;
+  case 45:
+    fmemcpy(&jit_buf[JIT_SIZE - aad8e1425a9f996d8f46b49c310c87f74_SIZE],aad8e1425a9f996d8f46b49c310c87f74,aad8e1425a9f996d8f46b49c310c87f74_SIZE);
+    return aad8e1425a9f996d8f46b49c310c87f74_SIZE;
+  case 46:
+    fmemcpy(&jit_buf[JIT_SIZE - ababfca0e8b27cb57204cb7d5e38e3aa7_SIZE],ababfca0e8b27cb57204cb7d5e38e3aa7,ababfca0e8b27cb57204cb7d5e38e3aa7_SIZE);
+    return ababfca0e8b27cb57204cb7d5e38e3aa7_SIZE;
+  case 47:
+    fmemcpy(&jit_buf[JIT_SIZE - acf21ad502955e1129230534880262acd_SIZE],acf21ad502955e1129230534880262acd,acf21ad502955e1129230534880262acd_SIZE);
+    return acf21ad502955e1129230534880262acd_SIZE;
+  case 49:
+    fmemcpy(&jit_buf[JIT_SIZE - aaf6c221b345a0fc40ee8b93af064a3a7_SIZE],aaf6c221b345a0fc40ee8b93af064a3a7,aaf6c221b345a0fc40ee8b93af064a3a7_SIZE);
+    return aaf6c221b345a0fc40ee8b93af064a3a7_SIZE;
+  case 50:
+    fmemcpy(&jit_buf[JIT_SIZE - a0f3f67e4a73d987e499a46d866503283_SIZE],a0f3f67e4a73d987e499a46d866503283,a0f3f67e4a73d987e499a46d866503283_SIZE);
+    return a0f3f67e4a73d987e499a46d866503283_SIZE;
+  case 51:
+    fmemcpy(&jit_buf[JIT_SIZE - ad2815a5f9eae59ae6a0c702c6712807e_SIZE],ad2815a5f9eae59ae6a0c702c6712807e,ad2815a5f9eae59ae6a0c702c6712807e_SIZE);
+    return ad2815a5f9eae59ae6a0c702c6712807e_SIZE;
+  case 52:
+    fmemcpy(&jit_buf[JIT_SIZE - aad3e107c21cd2587aa3281146fafb1fe_SIZE],aad3e107c21cd2587aa3281146fafb1fe,aad3e107c21cd2587aa3281146fafb1fe_SIZE);
+    return aad3e107c21cd2587aa3281146fafb1fe_SIZE;
+  case 53:
+    fmemcpy(&jit_buf[JIT_SIZE - ab2a62f980dc933b0c79a83dfa63e765e_SIZE],ab2a62f980dc933b0c79a83dfa63e765e,ab2a62f980dc933b0c79a83dfa63e765e_SIZE);
+    return ab2a62f980dc933b0c79a83dfa63e765e_SIZE;
+  case 54:
+    fmemcpy(&jit_buf[JIT_SIZE - a8e3fd2280b28c7f2750614c97b99184a_SIZE],a8e3fd2280b28c7f2750614c97b99184a,a8e3fd2280b28c7f2750614c97b99184a_SIZE);
+    return a8e3fd2280b28c7f2750614c97b99184a_SIZE;
+  case 55:
+    fmemcpy(&jit_buf[JIT_SIZE - ada6cfd51656aa1795efd8cf64730d554_SIZE],ada6cfd51656aa1795efd8cf64730d554,ada6cfd51656aa1795efd8cf64730d554_SIZE);
+    return ada6cfd51656aa1795efd8cf64730d554_SIZE;
+  case 56:
+    fmemcpy(&jit_buf[JIT_SIZE - ae32491f53e6c41eece664b7a7983d1c2_SIZE],ae32491f53e6c41eece664b7a7983d1c2,ae32491f53e6c41eece664b7a7983d1c2_SIZE);
+    return ae32491f53e6c41eece664b7a7983d1c2_SIZE;
+  case 57:
+    fmemcpy(&jit_buf[JIT_SIZE - a1768951e5526bf3adc516f15ad24cf3c_SIZE],a1768951e5526bf3adc516f15ad24cf3c,a1768951e5526bf3adc516f15ad24cf3c_SIZE);
+    return a1768951e5526bf3adc516f15ad24cf3c_SIZE;
+  case 58:
+    fmemcpy(&jit_buf[JIT_SIZE - a3fef024dcf670a95165877e59d27d6ef_SIZE],a3fef024dcf670a95165877e59d27d6ef,a3fef024dcf670a95165877e59d27d6ef_SIZE);
+    return a3fef024dcf670a95165877e59d27d6ef_SIZE;
+  case 59:
+    fmemcpy(&jit_buf[JIT_SIZE - ae895deff3aa743b499a12ca32e99e0a7_SIZE],ae895deff3aa743b499a12ca32e99e0a7,ae895deff3aa743b499a12ca32e99e0a7_SIZE);
+    return ae895deff3aa743b499a12ca32e99e0a7_SIZE;
+  case 60:
+    fmemcpy(&jit_buf[JIT_SIZE - a28547d56c9b1a8bc2220eb7e1a9121b9_SIZE],a28547d56c9b1a8bc2220eb7e1a9121b9,a28547d56c9b1a8bc2220eb7e1a9121b9_SIZE);
+    return a28547d56c9b1a8bc2220eb7e1a9121b9_SIZE;
+  case 61:
+    fmemcpy(&jit_buf[JIT_SIZE - a2b1b78c96448cca5d0d1d3a9e2b1caed_SIZE],a2b1b78c96448cca5d0d1d3a9e2b1caed,a2b1b78c96448cca5d0d1d3a9e2b1caed_SIZE);
+    return a2b1b78c96448cca5d0d1d3a9e2b1caed_SIZE;
+  case 63:
+    fmemcpy(&jit_buf[JIT_SIZE - aec108382dc94dca97c97186efee23d04_SIZE],aec108382dc94dca97c97186efee23d04,aec108382dc94dca97c97186efee23d04_SIZE);
+    return aec108382dc94dca97c97186efee23d04_SIZE;
+  case 64:
+    fmemcpy(&jit_buf[JIT_SIZE - a9a46648fe7448f0f27c0c6732ee47039_SIZE],a9a46648fe7448f0f27c0c6732ee47039,a9a46648fe7448f0f27c0c6732ee47039_SIZE);
+    return a9a46648fe7448f0f27c0c6732ee47039_SIZE;
+  case 65:
+    fmemcpy(&jit_buf[JIT_SIZE - afefd528b50ff171e044ae478c84704af_SIZE],afefd528b50ff171e044ae478c84704af,afefd528b50ff171e044ae478c84704af_SIZE);
+    return afefd528b50ff171e044ae478c84704af_SIZE;
+  case 66:
+    fmemcpy(&jit_buf[JIT_SIZE - a127ec31cf837b4d0cdf26df23b2f09a0_SIZE],a127ec31cf837b4d0cdf26df23b2f09a0,a127ec31cf837b4d0cdf26df23b2f09a0_SIZE);
+    return a127ec31cf837b4d0cdf26df23b2f09a0_SIZE;
+  case 67:
+    fmemcpy(&jit_buf[JIT_SIZE - a5d7c3196ca1703f196c10013f492e38c_SIZE],a5d7c3196ca1703f196c10013f492e38c,a5d7c3196ca1703f196c10013f492e38c_SIZE);
+    return a5d7c3196ca1703f196c10013f492e38c_SIZE;
+  case 68:
+    fmemcpy(&jit_buf[JIT_SIZE - ae8673bfa2e4100781cae921f8905343a_SIZE],ae8673bfa2e4100781cae921f8905343a,ae8673bfa2e4100781cae921f8905343a_SIZE);
+    return ae8673bfa2e4100781cae921f8905343a_SIZE;
+  case 69:
+    fmemcpy(&jit_buf[JIT_SIZE - afd0de470fb41fa3d0b33e7064bbdc769_SIZE],afd0de470fb41fa3d0b33e7064bbdc769,afd0de470fb41fa3d0b33e7064bbdc769_SIZE);
+    return afd0de470fb41fa3d0b33e7064bbdc769_SIZE;
+  case 70:
+    fmemcpy(&jit_buf[JIT_SIZE - a5e6a062995822935f0ef4666e3f33f58_SIZE],a5e6a062995822935f0ef4666e3f33f58,a5e6a062995822935f0ef4666e3f33f58_SIZE);
+    return a5e6a062995822935f0ef4666e3f33f58_SIZE;
+  case 71:
+    fmemcpy(&jit_buf[JIT_SIZE - a3ebbceec3656acb7a178f8286c65fb9b_SIZE],a3ebbceec3656acb7a178f8286c65fb9b,a3ebbceec3656acb7a178f8286c65fb9b_SIZE);
+    return a3ebbceec3656acb7a178f8286c65fb9b_SIZE;
+  case 72:
+    fmemcpy(&jit_buf[JIT_SIZE - ac5040b8d5b19907cdd25640122f99cea_SIZE],ac5040b8d5b19907cdd25640122f99cea,ac5040b8d5b19907cdd25640122f99cea_SIZE);
+    return ac5040b8d5b19907cdd25640122f99cea_SIZE;
+  case 73:
+    fmemcpy(&jit_buf[JIT_SIZE - a75f393921ba59caca4768e59945c1838_SIZE],a75f393921ba59caca4768e59945c1838,a75f393921ba59caca4768e59945c1838_SIZE);
+    return a75f393921ba59caca4768e59945c1838_SIZE;
+  case 74:
+    fmemcpy(&jit_buf[JIT_SIZE - a87ba7632444df1444f8900a26701ff30_SIZE],a87ba7632444df1444f8900a26701ff30,a87ba7632444df1444f8900a26701ff30_SIZE);
+    return a87ba7632444df1444f8900a26701ff30_SIZE;
+  case 75:
+    fmemcpy(&jit_buf[JIT_SIZE - a7d94954824720b465083be3799fa2678_SIZE],a7d94954824720b465083be3799fa2678,a7d94954824720b465083be3799fa2678_SIZE);
+    return a7d94954824720b465083be3799fa2678_SIZE;
+  case 76:
+    fmemcpy(&jit_buf[JIT_SIZE - a871d17bd2733a95c351a87fd39f40bc1_SIZE],a871d17bd2733a95c351a87fd39f40bc1,a871d17bd2733a95c351a87fd39f40bc1_SIZE);
+    return a871d17bd2733a95c351a87fd39f40bc1_SIZE;
+  case 77:
+    fmemcpy(&jit_buf[JIT_SIZE - aca6978f5e3ee2e7f8680322ab7df913a_SIZE],aca6978f5e3ee2e7f8680322ab7df913a,aca6978f5e3ee2e7f8680322ab7df913a_SIZE);
+    return aca6978f5e3ee2e7f8680322ab7df913a_SIZE;
+  case 78:
+    fmemcpy(&jit_buf[JIT_SIZE - a119b1b4777ff8f4ac6683787b8e182c4_SIZE],a119b1b4777ff8f4ac6683787b8e182c4,a119b1b4777ff8f4ac6683787b8e182c4_SIZE);
+    return a119b1b4777ff8f4ac6683787b8e182c4_SIZE;
+  case 79:
+    fmemcpy(&jit_buf[JIT_SIZE - a239d280f57c81c39796364b927966047_SIZE],a239d280f57c81c39796364b927966047,a239d280f57c81c39796364b927966047_SIZE);
+    return a239d280f57c81c39796364b927966047_SIZE;
+  case 80:
+    fmemcpy(&jit_buf[JIT_SIZE - ac8908a6478d9603bf763370ec10fadb8_SIZE],ac8908a6478d9603bf763370ec10fadb8,ac8908a6478d9603bf763370ec10fadb8_SIZE);
+    return ac8908a6478d9603bf763370ec10fadb8_SIZE;
+  case 81:
+    fmemcpy(&jit_buf[JIT_SIZE - a136dca921f7e6d2cdd601f014b90a093_SIZE],a136dca921f7e6d2cdd601f014b90a093,a136dca921f7e6d2cdd601f014b90a093_SIZE);
+    return a136dca921f7e6d2cdd601f014b90a093_SIZE;
+  case 82:
+    fmemcpy(&jit_buf[JIT_SIZE - a9685163845de7d44e6a31fa3a0653437_SIZE],a9685163845de7d44e6a31fa3a0653437,a9685163845de7d44e6a31fa3a0653437_SIZE);
+    return a9685163845de7d44e6a31fa3a0653437_SIZE;
+  case 83:
+    fmemcpy(&jit_buf[JIT_SIZE - a09b5b779ce6acd83c0dced0f64739fd4_SIZE],a09b5b779ce6acd83c0dced0f64739fd4,a09b5b779ce6acd83c0dced0f64739fd4_SIZE);
+    return a09b5b779ce6acd83c0dced0f64739fd4_SIZE;
+  case 84:
+    fmemcpy(&jit_buf[JIT_SIZE - aa6275f7c4f5b36324fb9c6e35934b5ed_SIZE],aa6275f7c4f5b36324fb9c6e35934b5ed,aa6275f7c4f5b36324fb9c6e35934b5ed_SIZE);
+    return aa6275f7c4f5b36324fb9c6e35934b5ed_SIZE;
+  case 85:
+    fmemcpy(&jit_buf[JIT_SIZE - a1cef3a1bf3980b6faa97e07f124357d2_SIZE],a1cef3a1bf3980b6faa97e07f124357d2,a1cef3a1bf3980b6faa97e07f124357d2_SIZE);
+    return a1cef3a1bf3980b6faa97e07f124357d2_SIZE;
+  case 86:
+    fmemcpy(&jit_buf[JIT_SIZE - a524f7d91738b8143194bd4c702898a6a_SIZE],a524f7d91738b8143194bd4c702898a6a,a524f7d91738b8143194bd4c702898a6a_SIZE);
+    return a524f7d91738b8143194bd4c702898a6a_SIZE;
+  case 87:
+    fmemcpy(&jit_buf[JIT_SIZE - ae4419464d570c4b497ba1979e790b104_SIZE],ae4419464d570c4b497ba1979e790b104,ae4419464d570c4b497ba1979e790b104_SIZE);
+    return ae4419464d570c4b497ba1979e790b104_SIZE;
+  case 88:
+    fmemcpy(&jit_buf[JIT_SIZE - aa212441eb83ac1231279219dda4c1ae6_SIZE],aa212441eb83ac1231279219dda4c1ae6,aa212441eb83ac1231279219dda4c1ae6_SIZE);
+    return aa212441eb83ac1231279219dda4c1ae6_SIZE;
+  case 89:
+    fmemcpy(&jit_buf[JIT_SIZE - a834ec731b589e8fd5ed8f04e5db1c74b_SIZE],a834ec731b589e8fd5ed8f04e5db1c74b,a834ec731b589e8fd5ed8f04e5db1c74b_SIZE);
+    return a834ec731b589e8fd5ed8f04e5db1c74b_SIZE;
+  case 90:
+    fmemcpy(&jit_buf[JIT_SIZE - ae0937501feb6b5a85393805ba9fd0f85_SIZE],ae0937501feb6b5a85393805ba9fd0f85,ae0937501feb6b5a85393805ba9fd0f85_SIZE);
+    return ae0937501feb6b5a85393805ba9fd0f85_SIZE;
+  case 91:
+    fmemcpy(&jit_buf[JIT_SIZE - abb32b6bf6306f0d322e01086d47941b7_SIZE],abb32b6bf6306f0d322e01086d47941b7,abb32b6bf6306f0d322e01086d47941b7_SIZE);
+    return abb32b6bf6306f0d322e01086d47941b7_SIZE;
+  case 92:
+    fmemcpy(&jit_buf[JIT_SIZE - af7a7798118ee9eedc779f4f0cab1b696_SIZE],af7a7798118ee9eedc779f4f0cab1b696,af7a7798118ee9eedc779f4f0cab1b696_SIZE);
+    return af7a7798118ee9eedc779f4f0cab1b696_SIZE;
+  case 93:
+    fmemcpy(&jit_buf[JIT_SIZE - a8f60c9900e3f8ac422104c5414e4ec8f_SIZE],a8f60c9900e3f8ac422104c5414e4ec8f,a8f60c9900e3f8ac422104c5414e4ec8f_SIZE);
+    return a8f60c9900e3f8ac422104c5414e4ec8f_SIZE;
+  case 94:
+    fmemcpy(&jit_buf[JIT_SIZE - a5586f139496777c48581cb6f297d44ff_SIZE],a5586f139496777c48581cb6f297d44ff,a5586f139496777c48581cb6f297d44ff_SIZE);
+    return a5586f139496777c48581cb6f297d44ff_SIZE;
+  case 95:
+    fmemcpy(&jit_buf[JIT_SIZE - a054f16051aba431c1af78002eb60429f_SIZE],a054f16051aba431c1af78002eb60429f,a054f16051aba431c1af78002eb60429f_SIZE);
+    return a054f16051aba431c1af78002eb60429f_SIZE;
+  case 96:
+    fmemcpy(&jit_buf[JIT_SIZE - af8721af216024d64a300612c107c1639_SIZE],af8721af216024d64a300612c107c1639,af8721af216024d64a300612c107c1639_SIZE);
+    return af8721af216024d64a300612c107c1639_SIZE;
+  case 98:
+    fmemcpy(&jit_buf[JIT_SIZE - a27fd680406cb8171f3b168ae4ac417b9_SIZE],a27fd680406cb8171f3b168ae4ac417b9,a27fd680406cb8171f3b168ae4ac417b9_SIZE);
+    return a27fd680406cb8171f3b168ae4ac417b9_SIZE;
+  case 99:
+    fmemcpy(&jit_buf[JIT_SIZE - a90a94ceab2da22e65d9b82daedd0f10a_SIZE],a90a94ceab2da22e65d9b82daedd0f10a,a90a94ceab2da22e65d9b82daedd0f10a_SIZE);
+    return a90a94ceab2da22e65d9b82daedd0f10a_SIZE;
+  case 100:
+    fmemcpy(&jit_buf[JIT_SIZE - a8c18d3074079aed6c34bb5c3c93e3510_SIZE],a8c18d3074079aed6c34bb5c3c93e3510,a8c18d3074079aed6c34bb5c3c93e3510_SIZE);
+    return a8c18d3074079aed6c34bb5c3c93e3510_SIZE;
+  case 101:
+    fmemcpy(&jit_buf[JIT_SIZE - a4be01313202c374dbce1fa30458f7473_SIZE],a4be01313202c374dbce1fa30458f7473,a4be01313202c374dbce1fa30458f7473_SIZE);
+    return a4be01313202c374dbce1fa30458f7473_SIZE;
+  case 102:
+    fmemcpy(&jit_buf[JIT_SIZE - a5605ca30fdb603ff5096a38e0ec75833_SIZE],a5605ca30fdb603ff5096a38e0ec75833,a5605ca30fdb603ff5096a38e0ec75833_SIZE);
+    return a5605ca30fdb603ff5096a38e0ec75833_SIZE;
+  case 103:
+    fmemcpy(&jit_buf[JIT_SIZE - ad0bf48f2ccaa82c32426e7ab8037c792_SIZE],ad0bf48f2ccaa82c32426e7ab8037c792,ad0bf48f2ccaa82c32426e7ab8037c792_SIZE);
+    return ad0bf48f2ccaa82c32426e7ab8037c792_SIZE;
+  case 104:
+    fmemcpy(&jit_buf[JIT_SIZE - a9f1197a0bbf6026fc4526079b37725bb_SIZE],a9f1197a0bbf6026fc4526079b37725bb,a9f1197a0bbf6026fc4526079b37725bb_SIZE);
+    return a9f1197a0bbf6026fc4526079b37725bb_SIZE;
+  case 105:
+    fmemcpy(&jit_buf[JIT_SIZE - a95934e80031e6d027700bf7022169312_SIZE],a95934e80031e6d027700bf7022169312,a95934e80031e6d027700bf7022169312_SIZE);
+    return a95934e80031e6d027700bf7022169312_SIZE;
+  case 106:
+    fmemcpy(&jit_buf[JIT_SIZE - a080dc67c4202725e05c5204c74e1213e_SIZE],a080dc67c4202725e05c5204c74e1213e,a080dc67c4202725e05c5204c74e1213e_SIZE);
+    return a080dc67c4202725e05c5204c74e1213e_SIZE;
+  case 107:
+    fmemcpy(&jit_buf[JIT_SIZE - a82e107c36c5150f1a24a6d7264cc631f_SIZE],a82e107c36c5150f1a24a6d7264cc631f,a82e107c36c5150f1a24a6d7264cc631f_SIZE);
+    return a82e107c36c5150f1a24a6d7264cc631f_SIZE;
+  case 108:
+    fmemcpy(&jit_buf[JIT_SIZE - af07cd09f69c6da71324d330848c29a92_SIZE],af07cd09f69c6da71324d330848c29a92,af07cd09f69c6da71324d330848c29a92_SIZE);
+    return af07cd09f69c6da71324d330848c29a92_SIZE;
+  case 109:
+    fmemcpy(&jit_buf[JIT_SIZE - aa519beea791acca93c905914528174b2_SIZE],aa519beea791acca93c905914528174b2,aa519beea791acca93c905914528174b2_SIZE);
+    return aa519beea791acca93c905914528174b2_SIZE;
+  case 110:
+    fmemcpy(&jit_buf[JIT_SIZE - a8b43722e08551dd327ad236c54b690fb_SIZE],a8b43722e08551dd327ad236c54b690fb,a8b43722e08551dd327ad236c54b690fb_SIZE);
+    return a8b43722e08551dd327ad236c54b690fb_SIZE;
+  case 111:
+    fmemcpy(&jit_buf[JIT_SIZE - a87fa21746e95d6087b825b6bdf94a9a4_SIZE],a87fa21746e95d6087b825b6bdf94a9a4,a87fa21746e95d6087b825b6bdf94a9a4_SIZE);
+    return a87fa21746e95d6087b825b6bdf94a9a4_SIZE;
+  case 112:
+    fmemcpy(&jit_buf[JIT_SIZE - a7129855e51ff4fe92d51fb969f0e06e6_SIZE],a7129855e51ff4fe92d51fb969f0e06e6,a7129855e51ff4fe92d51fb969f0e06e6_SIZE);
+    return a7129855e51ff4fe92d51fb969f0e06e6_SIZE;
+  case 113:
+    fmemcpy(&jit_buf[JIT_SIZE - a7cf08ff16d9d0e12060e701d7d313f00_SIZE],a7cf08ff16d9d0e12060e701d7d313f00,a7cf08ff16d9d0e12060e701d7d313f00_SIZE);
+    return a7cf08ff16d9d0e12060e701d7d313f00_SIZE;
+  case 114:
+    fmemcpy(&jit_buf[JIT_SIZE - ab02f398a7bfb3a3024f5098f1acfbd1b_SIZE],ab02f398a7bfb3a3024f5098f1acfbd1b,ab02f398a7bfb3a3024f5098f1acfbd1b_SIZE);
+    return ab02f398a7bfb3a3024f5098f1acfbd1b_SIZE;
+  case 115:
+    fmemcpy(&jit_buf[JIT_SIZE - a9f7001bbb395401d6b4d8c2f6618046e_SIZE],a9f7001bbb395401d6b4d8c2f6618046e,a9f7001bbb395401d6b4d8c2f6618046e_SIZE);
+    return a9f7001bbb395401d6b4d8c2f6618046e_SIZE;
+  case 116:
+    fmemcpy(&jit_buf[JIT_SIZE - a109bb19a7dd1186c086cb85a3f4059d3_SIZE],a109bb19a7dd1186c086cb85a3f4059d3,a109bb19a7dd1186c086cb85a3f4059d3_SIZE);
+    return a109bb19a7dd1186c086cb85a3f4059d3_SIZE;
+  case 117:
+    fmemcpy(&jit_buf[JIT_SIZE - a09919bb973d2ef4558b2599d6f5890ee_SIZE],a09919bb973d2ef4558b2599d6f5890ee,a09919bb973d2ef4558b2599d6f5890ee_SIZE);
+    return a09919bb973d2ef4558b2599d6f5890ee_SIZE;
+  case 118:
+    fmemcpy(&jit_buf[JIT_SIZE - a2e1b88e1f2c9bd9abd9675aad9121dfc_SIZE],a2e1b88e1f2c9bd9abd9675aad9121dfc,a2e1b88e1f2c9bd9abd9675aad9121dfc_SIZE);
+    return a2e1b88e1f2c9bd9abd9675aad9121dfc_SIZE;
+  case 119:
+    fmemcpy(&jit_buf[JIT_SIZE - a725c98df9c7abd282d51b0a95914a32f_SIZE],a725c98df9c7abd282d51b0a95914a32f,a725c98df9c7abd282d51b0a95914a32f_SIZE);
+    return a725c98df9c7abd282d51b0a95914a32f_SIZE;
+  case 120:
+    fmemcpy(&jit_buf[JIT_SIZE - a6bee54868d34cff91e9045f81731dc83_SIZE],a6bee54868d34cff91e9045f81731dc83,a6bee54868d34cff91e9045f81731dc83_SIZE);
+    return a6bee54868d34cff91e9045f81731dc83_SIZE;
+  case 121:
+    fmemcpy(&jit_buf[JIT_SIZE - a3ef726d7b7a4d148ef8d62cff1c84985_SIZE],a3ef726d7b7a4d148ef8d62cff1c84985,a3ef726d7b7a4d148ef8d62cff1c84985_SIZE);
+    return a3ef726d7b7a4d148ef8d62cff1c84985_SIZE;
+  case 122:
+    fmemcpy(&jit_buf[JIT_SIZE - a6743226bdb64644dea5040b82ecdf2ec_SIZE],a6743226bdb64644dea5040b82ecdf2ec,a6743226bdb64644dea5040b82ecdf2ec_SIZE);
+    return a6743226bdb64644dea5040b82ecdf2ec_SIZE;
+  case 123:
+    fmemcpy(&jit_buf[JIT_SIZE - a63dca0e0d8c9b6e74dc1ff303d49839a_SIZE],a63dca0e0d8c9b6e74dc1ff303d49839a,a63dca0e0d8c9b6e74dc1ff303d49839a_SIZE);
+    return a63dca0e0d8c9b6e74dc1ff303d49839a_SIZE;
+  case 124:
+    fmemcpy(&jit_buf[JIT_SIZE - a58d311daaa137c6aea259bcac0b028a6_SIZE],a58d311daaa137c6aea259bcac0b028a6,a58d311daaa137c6aea259bcac0b028a6_SIZE);
+    return a58d311daaa137c6aea259bcac0b028a6_SIZE;
+  case 125:
+    fmemcpy(&jit_buf[JIT_SIZE - aa90bcb03cac5e6e463c2031febb019a2_SIZE],aa90bcb03cac5e6e463c2031febb019a2,aa90bcb03cac5e6e463c2031febb019a2_SIZE);
+    return aa90bcb03cac5e6e463c2031febb019a2_SIZE;
+  case 126:
+    fmemcpy(&jit_buf[JIT_SIZE - ad910ed653540b5df17c797e114fc299e_SIZE],ad910ed653540b5df17c797e114fc299e,ad910ed653540b5df17c797e114fc299e_SIZE);
+    return ad910ed653540b5df17c797e114fc299e_SIZE;
+
+  default:
+    break;
+  }
+
+  return 0;
+}
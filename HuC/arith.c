@@ -0,0 +1,472 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2014 Antonio SJ Musumeci <trapexit@spawn.link>
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+/*
+  Arithmetic kernels
+
+  Table driven versions of the conversions and math behind FX33, 9XY1,
+  9XY2 and 9XY3. The 6280 has no multiply or divide and HuC's generic
+  helpers loop over every bit, so:
+
+  - FX33: hundreds digit and packed tens / ones straight from
+    arith_bcd_100 and arith_bcd_10.
+  - 9XY3: the high byte's contribution (N * 256) comes from
+    arith_bcd16_* in packed BCD and is added to the low byte's from
+    the 8 bit tables with the CPU in decimal mode.
+  - 9XY1: quarter squares, A * B = sq(A+B) - sq(|A-B|) with
+    sq(n) = n^2 / 4 for n in 0 - 510.
+  - 9XY2: an unrolled shift / subtract; a 64K entry table won't fit.
+    Dividing by 0 gives a quotient of 0xFF and leaves the dividend as
+    the remainder.
+
+  The tables are const so they live in HuC's constants bank, which is
+  always mapped at $4000, and the kernels can index them directly with
+  no bank switching.
+
+  bench.c has cycle counts against the old C code.
+*/
+
+const unsigned char arith_bcd_100[256] =
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02
+  };
+
+const unsigned char arith_bcd_10[256] =
+  {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95,
+    0x96, 0x97, 0x98, 0x99, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x90, 0x91,
+    0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x50, 0x51,
+    0x52, 0x53, 0x54, 0x55
+  };
+
+const unsigned char arith_bcd16_0[256] =
+  {
+    0x00, 0x56, 0x12, 0x68, 0x24, 0x80, 0x36, 0x92, 0x48, 0x04, 0x60, 0x16,
+    0x72, 0x28, 0x84, 0x40, 0x96, 0x52, 0x08, 0x64, 0x20, 0x76, 0x32, 0x88,
+    0x44, 0x00, 0x56, 0x12, 0x68, 0x24, 0x80, 0x36, 0x92, 0x48, 0x04, 0x60,
+    0x16, 0x72, 0x28, 0x84, 0x40, 0x96, 0x52, 0x08, 0x64, 0x20, 0x76, 0x32,
+    0x88, 0x44, 0x00, 0x56, 0x12, 0x68, 0x24, 0x80, 0x36, 0x92, 0x48, 0x04,
+    0x60, 0x16, 0x72, 0x28, 0x84, 0x40, 0x96, 0x52, 0x08, 0x64, 0x20, 0x76,
+    0x32, 0x88, 0x44, 0x00, 0x56, 0x12, 0x68, 0x24, 0x80, 0x36, 0x92, 0x48,
+    0x04, 0x60, 0x16, 0x72, 0x28, 0x84, 0x40, 0x96, 0x52, 0x08, 0x64, 0x20,
+    0x76, 0x32, 0x88, 0x44, 0x00, 0x56, 0x12, 0x68, 0x24, 0x80, 0x36, 0x92,
+    0x48, 0x04, 0x60, 0x16, 0x72, 0x28, 0x84, 0x40, 0x96, 0x52, 0x08, 0x64,
+    0x20, 0x76, 0x32, 0x88, 0x44, 0x00, 0x56, 0x12, 0x68, 0x24, 0x80, 0x36,
+    0x92, 0x48, 0x04, 0x60, 0x16, 0x72, 0x28, 0x84, 0x40, 0x96, 0x52, 0x08,
+    0x64, 0x20, 0x76, 0x32, 0x88, 0x44, 0x00, 0x56, 0x12, 0x68, 0x24, 0x80,
+    0x36, 0x92, 0x48, 0x04, 0x60, 0x16, 0x72, 0x28, 0x84, 0x40, 0x96, 0x52,
+    0x08, 0x64, 0x20, 0x76, 0x32, 0x88, 0x44, 0x00, 0x56, 0x12, 0x68, 0x24,
+    0x80, 0x36, 0x92, 0x48, 0x04, 0x60, 0x16, 0x72, 0x28, 0x84, 0x40, 0x96,
+    0x52, 0x08, 0x64, 0x20, 0x76, 0x32, 0x88, 0x44, 0x00, 0x56, 0x12, 0x68,
+    0x24, 0x80, 0x36, 0x92, 0x48, 0x04, 0x60, 0x16, 0x72, 0x28, 0x84, 0x40,
+    0x96, 0x52, 0x08, 0x64, 0x20, 0x76, 0x32, 0x88, 0x44, 0x00, 0x56, 0x12,
+    0x68, 0x24, 0x80, 0x36, 0x92, 0x48, 0x04, 0x60, 0x16, 0x72, 0x28, 0x84,
+    0x40, 0x96, 0x52, 0x08, 0x64, 0x20, 0x76, 0x32, 0x88, 0x44, 0x00, 0x56,
+    0x12, 0x68, 0x24, 0x80
+  };
+
+const unsigned char arith_bcd16_1[256] =
+  {
+    0x00, 0x02, 0x05, 0x07, 0x10, 0x12, 0x15, 0x17, 0x20, 0x23, 0x25, 0x28,
+    0x30, 0x33, 0x35, 0x38, 0x40, 0x43, 0x46, 0x48, 0x51, 0x53, 0x56, 0x58,
+    0x61, 0x64, 0x66, 0x69, 0x71, 0x74, 0x76, 0x79, 0x81, 0x84, 0x87, 0x89,
+    0x92, 0x94, 0x97, 0x99, 0x02, 0x04, 0x07, 0x10, 0x12, 0x15, 0x17, 0x20,
+    0x22, 0x25, 0x28, 0x30, 0x33, 0x35, 0x38, 0x40, 0x43, 0x45, 0x48, 0x51,
+    0x53, 0x56, 0x58, 0x61, 0x63, 0x66, 0x68, 0x71, 0x74, 0x76, 0x79, 0x81,
+    0x84, 0x86, 0x89, 0x92, 0x94, 0x97, 0x99, 0x02, 0x04, 0x07, 0x09, 0x12,
+    0x15, 0x17, 0x20, 0x22, 0x25, 0x27, 0x30, 0x32, 0x35, 0x38, 0x40, 0x43,
+    0x45, 0x48, 0x50, 0x53, 0x56, 0x58, 0x61, 0x63, 0x66, 0x68, 0x71, 0x73,
+    0x76, 0x79, 0x81, 0x84, 0x86, 0x89, 0x91, 0x94, 0x96, 0x99, 0x02, 0x04,
+    0x07, 0x09, 0x12, 0x14, 0x17, 0x20, 0x22, 0x25, 0x27, 0x30, 0x32, 0x35,
+    0x37, 0x40, 0x43, 0x45, 0x48, 0x50, 0x53, 0x55, 0x58, 0x60, 0x63, 0x66,
+    0x68, 0x71, 0x73, 0x76, 0x78, 0x81, 0x84, 0x86, 0x89, 0x91, 0x94, 0x96,
+    0x99, 0x01, 0x04, 0x07, 0x09, 0x12, 0x14, 0x17, 0x19, 0x22, 0x24, 0x27,
+    0x30, 0x32, 0x35, 0x37, 0x40, 0x42, 0x45, 0x48, 0x50, 0x53, 0x55, 0x58,
+    0x60, 0x63, 0x65, 0x68, 0x71, 0x73, 0x76, 0x78, 0x81, 0x83, 0x86, 0x88,
+    0x91, 0x94, 0x96, 0x99, 0x01, 0x04, 0x06, 0x09, 0x12, 0x14, 0x17, 0x19,
+    0x22, 0x24, 0x27, 0x29, 0x32, 0x35, 0x37, 0x40, 0x42, 0x45, 0x47, 0x50,
+    0x52, 0x55, 0x58, 0x60, 0x63, 0x65, 0x68, 0x70, 0x73, 0x76, 0x78, 0x81,
+    0x83, 0x86, 0x88, 0x91, 0x93, 0x96, 0x99, 0x01, 0x04, 0x06, 0x09, 0x11,
+    0x14, 0x16, 0x19, 0x22, 0x24, 0x27, 0x29, 0x32, 0x34, 0x37, 0x40, 0x42,
+    0x45, 0x47, 0x50, 0x52
+  };
+
+const unsigned char arith_bcd16_2[256] =
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06
+  };
+
+const unsigned char arith_sq_lo[511] =
+  {
+    0x00, 0x00, 0x01, 0x02, 0x04, 0x06, 0x09, 0x0C, 0x10, 0x14, 0x19, 0x1E,
+    0x24, 0x2A, 0x31, 0x38, 0x40, 0x48, 0x51, 0x5A, 0x64, 0x6E, 0x79, 0x84,
+    0x90, 0x9C, 0xA9, 0xB6, 0xC4, 0xD2, 0xE1, 0xF0, 0x00, 0x10, 0x21, 0x32,
+    0x44, 0x56, 0x69, 0x7C, 0x90, 0xA4, 0xB9, 0xCE, 0xE4, 0xFA, 0x11, 0x28,
+    0x40, 0x58, 0x71, 0x8A, 0xA4, 0xBE, 0xD9, 0xF4, 0x10, 0x2C, 0x49, 0x66,
+    0x84, 0xA2, 0xC1, 0xE0, 0x00, 0x20, 0x41, 0x62, 0x84, 0xA6, 0xC9, 0xEC,
+    0x10, 0x34, 0x59, 0x7E, 0xA4, 0xCA, 0xF1, 0x18, 0x40, 0x68, 0x91, 0xBA,
+    0xE4, 0x0E, 0x39, 0x64, 0x90, 0xBC, 0xE9, 0x16, 0x44, 0x72, 0xA1, 0xD0,
+    0x00, 0x30, 0x61, 0x92, 0xC4, 0xF6, 0x29, 0x5C, 0x90, 0xC4, 0xF9, 0x2E,
+    0x64, 0x9A, 0xD1, 0x08, 0x40, 0x78, 0xB1, 0xEA, 0x24, 0x5E, 0x99, 0xD4,
+    0x10, 0x4C, 0x89, 0xC6, 0x04, 0x42, 0x81, 0xC0, 0x00, 0x40, 0x81, 0xC2,
+    0x04, 0x46, 0x89, 0xCC, 0x10, 0x54, 0x99, 0xDE, 0x24, 0x6A, 0xB1, 0xF8,
+    0x40, 0x88, 0xD1, 0x1A, 0x64, 0xAE, 0xF9, 0x44, 0x90, 0xDC, 0x29, 0x76,
+    0xC4, 0x12, 0x61, 0xB0, 0x00, 0x50, 0xA1, 0xF2, 0x44, 0x96, 0xE9, 0x3C,
+    0x90, 0xE4, 0x39, 0x8E, 0xE4, 0x3A, 0x91, 0xE8, 0x40, 0x98, 0xF1, 0x4A,
+    0xA4, 0xFE, 0x59, 0xB4, 0x10, 0x6C, 0xC9, 0x26, 0x84, 0xE2, 0x41, 0xA0,
+    0x00, 0x60, 0xC1, 0x22, 0x84, 0xE6, 0x49, 0xAC, 0x10, 0x74, 0xD9, 0x3E,
+    0xA4, 0x0A, 0x71, 0xD8, 0x40, 0xA8, 0x11, 0x7A, 0xE4, 0x4E, 0xB9, 0x24,
+    0x90, 0xFC, 0x69, 0xD6, 0x44, 0xB2, 0x21, 0x90, 0x00, 0x70, 0xE1, 0x52,
+    0xC4, 0x36, 0xA9, 0x1C, 0x90, 0x04, 0x79, 0xEE, 0x64, 0xDA, 0x51, 0xC8,
+    0x40, 0xB8, 0x31, 0xAA, 0x24, 0x9E, 0x19, 0x94, 0x10, 0x8C, 0x09, 0x86,
+    0x04, 0x82, 0x01, 0x80, 0x00, 0x80, 0x01, 0x82, 0x04, 0x86, 0x09, 0x8C,
+    0x10, 0x94, 0x19, 0x9E, 0x24, 0xAA, 0x31, 0xB8, 0x40, 0xC8, 0x51, 0xDA,
+    0x64, 0xEE, 0x79, 0x04, 0x90, 0x1C, 0xA9, 0x36, 0xC4, 0x52, 0xE1, 0x70,
+    0x00, 0x90, 0x21, 0xB2, 0x44, 0xD6, 0x69, 0xFC, 0x90, 0x24, 0xB9, 0x4E,
+    0xE4, 0x7A, 0x11, 0xA8, 0x40, 0xD8, 0x71, 0x0A, 0xA4, 0x3E, 0xD9, 0x74,
+    0x10, 0xAC, 0x49, 0xE6, 0x84, 0x22, 0xC1, 0x60, 0x00, 0xA0, 0x41, 0xE2,
+    0x84, 0x26, 0xC9, 0x6C, 0x10, 0xB4, 0x59, 0xFE, 0xA4, 0x4A, 0xF1, 0x98,
+    0x40, 0xE8, 0x91, 0x3A, 0xE4, 0x8E, 0x39, 0xE4, 0x90, 0x3C, 0xE9, 0x96,
+    0x44, 0xF2, 0xA1, 0x50, 0x00, 0xB0, 0x61, 0x12, 0xC4, 0x76, 0x29, 0xDC,
+    0x90, 0x44, 0xF9, 0xAE, 0x64, 0x1A, 0xD1, 0x88, 0x40, 0xF8, 0xB1, 0x6A,
+    0x24, 0xDE, 0x99, 0x54, 0x10, 0xCC, 0x89, 0x46, 0x04, 0xC2, 0x81, 0x40,
+    0x00, 0xC0, 0x81, 0x42, 0x04, 0xC6, 0x89, 0x4C, 0x10, 0xD4, 0x99, 0x5E,
+    0x24, 0xEA, 0xB1, 0x78, 0x40, 0x08, 0xD1, 0x9A, 0x64, 0x2E, 0xF9, 0xC4,
+    0x90, 0x5C, 0x29, 0xF6, 0xC4, 0x92, 0x61, 0x30, 0x00, 0xD0, 0xA1, 0x72,
+    0x44, 0x16, 0xE9, 0xBC, 0x90, 0x64, 0x39, 0x0E, 0xE4, 0xBA, 0x91, 0x68,
+    0x40, 0x18, 0xF1, 0xCA, 0xA4, 0x7E, 0x59, 0x34, 0x10, 0xEC, 0xC9, 0xA6,
+    0x84, 0x62, 0x41, 0x20, 0x00, 0xE0, 0xC1, 0xA2, 0x84, 0x66, 0x49, 0x2C,
+    0x10, 0xF4, 0xD9, 0xBE, 0xA4, 0x8A, 0x71, 0x58, 0x40, 0x28, 0x11, 0xFA,
+    0xE4, 0xCE, 0xB9, 0xA4, 0x90, 0x7C, 0x69, 0x56, 0x44, 0x32, 0x21, 0x10,
+    0x00, 0xF0, 0xE1, 0xD2, 0xC4, 0xB6, 0xA9, 0x9C, 0x90, 0x84, 0x79, 0x6E,
+    0x64, 0x5A, 0x51, 0x48, 0x40, 0x38, 0x31, 0x2A, 0x24, 0x1E, 0x19, 0x14,
+    0x10, 0x0C, 0x09, 0x06, 0x04, 0x02, 0x01
+  };
+
+const unsigned char arith_sq_hi[511] =
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B,
+    0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x10, 0x10, 0x10, 0x10,
+    0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13,
+    0x14, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x16, 0x16, 0x16, 0x17, 0x17,
+    0x17, 0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x1A, 0x1A, 0x1B,
+    0x1B, 0x1B, 0x1C, 0x1C, 0x1C, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1F,
+    0x1F, 0x1F, 0x20, 0x20, 0x21, 0x21, 0x21, 0x22, 0x22, 0x22, 0x23, 0x23,
+    0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x26, 0x26, 0x27, 0x27, 0x27, 0x28,
+    0x28, 0x29, 0x29, 0x29, 0x2A, 0x2A, 0x2B, 0x2B, 0x2B, 0x2C, 0x2C, 0x2D,
+    0x2D, 0x2D, 0x2E, 0x2E, 0x2F, 0x2F, 0x30, 0x30, 0x31, 0x31, 0x31, 0x32,
+    0x32, 0x33, 0x33, 0x34, 0x34, 0x35, 0x35, 0x35, 0x36, 0x36, 0x37, 0x37,
+    0x38, 0x38, 0x39, 0x39, 0x3A, 0x3A, 0x3B, 0x3B, 0x3C, 0x3C, 0x3D, 0x3D,
+    0x3E, 0x3E, 0x3F, 0x3F, 0x40, 0x40, 0x41, 0x41, 0x42, 0x42, 0x43, 0x43,
+    0x44, 0x44, 0x45, 0x45, 0x46, 0x46, 0x47, 0x47, 0x48, 0x48, 0x49, 0x49,
+    0x4A, 0x4A, 0x4B, 0x4C, 0x4C, 0x4D, 0x4D, 0x4E, 0x4E, 0x4F, 0x4F, 0x50,
+    0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x54, 0x54, 0x55, 0x56, 0x56, 0x57,
+    0x57, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5E,
+    0x5F, 0x5F, 0x60, 0x60, 0x61, 0x62, 0x62, 0x63, 0x64, 0x64, 0x65, 0x65,
+    0x66, 0x67, 0x67, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6C, 0x6C, 0x6D,
+    0x6E, 0x6E, 0x6F, 0x70, 0x70, 0x71, 0x72, 0x72, 0x73, 0x74, 0x74, 0x75,
+    0x76, 0x76, 0x77, 0x78, 0x79, 0x79, 0x7A, 0x7B, 0x7B, 0x7C, 0x7D, 0x7D,
+    0x7E, 0x7F, 0x7F, 0x80, 0x81, 0x82, 0x82, 0x83, 0x84, 0x84, 0x85, 0x86,
+    0x87, 0x87, 0x88, 0x89, 0x8A, 0x8A, 0x8B, 0x8C, 0x8D, 0x8D, 0x8E, 0x8F,
+    0x90, 0x90, 0x91, 0x92, 0x93, 0x93, 0x94, 0x95, 0x96, 0x96, 0x97, 0x98,
+    0x99, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9D, 0x9E, 0x9F, 0xA0, 0xA0, 0xA1,
+    0xA2, 0xA3, 0xA4, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xA9, 0xAA, 0xAB,
+    0xAC, 0xAD, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB2, 0xB3, 0xB4, 0xB5,
+    0xB6, 0xB7, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBD, 0xBE, 0xBF,
+    0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA,
+    0xCB, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD4,
+    0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0xE0,
+    0xE1, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB,
+    0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7,
+    0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE
+  };
+
+
+/*
+  arith_bcd8(dest, num)
+
+  dest[0..2] = decimal digits of num.
+*/
+#pragma fastcall arith_bcd8(word di, byte acc)
+
+/*
+  arith_bcd16(dest, num)
+
+  dest[0..4] = decimal digits of num.
+*/
+#pragma fastcall arith_bcd16(word di, word acc)
+
+/*
+  arith_mul(a, b)
+
+  Returns a * b.
+*/
+#pragma fastcall arith_mul(byte al, byte acc)
+
+/*
+  arith_div(a, b)
+
+  Returns a / b in the low byte and a % b in the high byte.
+*/
+#pragma fastcall arith_div(byte al, byte acc)
+
+#asm
+.code
+_arith_bcd8.2:
+        lda  _arith_bcd_100,X
+        sta  [_di]
+        lda  _arith_bcd_10,X
+        tax
+        lsr  A
+        lsr  A
+        lsr  A
+        lsr  A
+        ldy  #1
+        sta  [_di],Y
+        txa
+        and  #$0F
+        iny
+        sta  [_di],Y
+        rts
+
+_arith_bcd16.2:
+        tay
+        sed
+        clc
+        lda  _arith_bcd_10,X
+        adc  _arith_bcd16_0,Y
+        sta  <__temp
+        lda  _arith_bcd_100,X
+        adc  _arith_bcd16_1,Y
+        sta  <__temp+1
+        lda  _arith_bcd16_2,Y
+        adc  #0
+        cld
+        sta  [_di]
+        lda  <__temp+1
+        lsr  A
+        lsr  A
+        lsr  A
+        lsr  A
+        ldy  #1
+        sta  [_di],Y
+        lda  <__temp+1
+        and  #$0F
+        iny
+        sta  [_di],Y
+        lda  <__temp
+        lsr  A
+        lsr  A
+        lsr  A
+        lsr  A
+        iny
+        sta  [_di],Y
+        lda  <__temp
+        and  #$0F
+        iny
+        sta  [_di],Y
+        rts
+
+_arith_mul.2:
+        stx  <__temp
+        sec
+        lda  <_al
+        sbc  <__temp
+        bcs  .diff
+        eor  #$FF
+        inc  A
+.diff:
+        tay
+        clc
+        lda  <_al
+        adc  <__temp
+        tax
+        bcs  .high
+        sec
+        lda  _arith_sq_lo,X
+        sbc  _arith_sq_lo,Y
+        sta  <__temp
+        lda  _arith_sq_hi,X
+        sbc  _arith_sq_hi,Y
+        ldx  <__temp
+        rts
+.high:
+        sec
+        lda  _arith_sq_lo+256,X
+        sbc  _arith_sq_lo,Y
+        sta  <__temp
+        lda  _arith_sq_hi+256,X
+        sbc  _arith_sq_hi,Y
+        ldx  <__temp
+        rts
+
+_arith_div.2:
+        stx  <__temp
+        lda  <_al
+        sta  <__temp+1
+        cla
+        asl  <__temp+1
+        rol  A
+        bcs  .sub0
+        cmp  <__temp
+        bcc  .next0
+.sub0:
+        sbc  <__temp
+        inc  <__temp+1
+.next0:
+        asl  <__temp+1
+        rol  A
+        bcs  .sub1
+        cmp  <__temp
+        bcc  .next1
+.sub1:
+        sbc  <__temp
+        inc  <__temp+1
+.next1:
+        asl  <__temp+1
+        rol  A
+        bcs  .sub2
+        cmp  <__temp
+        bcc  .next2
+.sub2:
+        sbc  <__temp
+        inc  <__temp+1
+.next2:
+        asl  <__temp+1
+        rol  A
+        bcs  .sub3
+        cmp  <__temp
+        bcc  .next3
+.sub3:
+        sbc  <__temp
+        inc  <__temp+1
+.next3:
+        asl  <__temp+1
+        rol  A
+        bcs  .sub4
+        cmp  <__temp
+        bcc  .next4
+.sub4:
+        sbc  <__temp
+        inc  <__temp+1
+.next4:
+        asl  <__temp+1
+        rol  A
+        bcs  .sub5
+        cmp  <__temp
+        bcc  .next5
+.sub5:
+        sbc  <__temp
+        inc  <__temp+1
+.next5:
+        asl  <__temp+1
+        rol  A
+        bcs  .sub6
+        cmp  <__temp
+        bcc  .next6
+.sub6:
+        sbc  <__temp
+        inc  <__temp+1
+.next6:
+        asl  <__temp+1
+        rol  A
+        bcs  .sub7
+        cmp  <__temp
+        bcc  .next7
+.sub7:
+        sbc  <__temp
+        inc  <__temp+1
+.next7:
+        ldx  <__temp+1
+        rts
+#endasm
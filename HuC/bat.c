@@ -0,0 +1,185 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2014 Antonio SJ Musumeci <trapexit@spawn.link>
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+/*
+  BAT renderer
+
+  With the 8x7 pixels of the tile renderer, every tile holds the
+  bottom of one CHIP-8 row and the top of the next, split after line
+  1 to 7 depending on the tile row (tile row 0 is rows 0 and 1 split
+  after line 7, tile row 1 is rows 1 and 2 split after line 6 and so
+  on, repeating every 7 tile rows). So there are only 7 splits times
+  4 on / off combinations of tile. With display_mode set to
+  DISPLAY_BAT those 28 tiles are loaded once at BAT_VADDR and a pixel
+  is drawn by pointing the BAT entries of the one or two tiles its row
+  touches at the right one. CLS is a BAT fill of the area drawn in.
+
+  bat_ty0 / bat_ty1 are the first and last tile row of each CHIP-8
+  row. bat_top is the upper row in each tile row and bat_split the
+  BAT entry for that tile row with both rows off. Bit 1 of the entry
+  is the upper row and bit 0 the lower.
+*/
+
+#define BAT_VADDR 0x1000
+#define BAT_BLANK (BAT_VADDR >> 4)
+
+const unsigned char bat_ty0[32] =
+  {
+     0,  0,  1,  2,  3,  4,  5,  6,  7,  7,  8,  9, 10, 11, 12, 13,
+    14, 14, 15, 16, 17, 18, 19, 20, 21, 21, 22, 23, 24, 25, 26, 27
+  };
+
+const unsigned char bat_ty1[32] =
+  {
+     0,  1,  2,  3,  4,  5,  6,  6,  7,  8,  9, 10, 11, 12, 13, 13,
+    14, 15, 16, 17, 18, 19, 20, 20, 21, 22, 23, 24, 25, 26, 27, 27
+  };
+
+const unsigned char bat_top[28] =
+  {
+     0,  1,  2,  3,  4,  5,  6,  8,  9, 10, 11, 12, 13, 14,
+    16, 17, 18, 19, 20, 21, 22, 24, 25, 26, 27, 28, 29, 30
+  };
+
+const unsigned int bat_split[28] =
+  {
+    0x118, 0x114, 0x110, 0x10C, 0x108, 0x104, 0x100,
+    0x118, 0x114, 0x110, 0x10C, 0x108, 0x104, 0x100,
+    0x118, 0x114, 0x110, 0x10C, 0x108, 0x104, 0x100,
+    0x118, 0x114, 0x110, 0x10C, 0x108, 0x104, 0x100
+  };
+
+/*
+  Load the 28 tiles and blank the BAT.
+*/
+void
+bat_init(void)
+{
+  static char split;
+  static char pattern;
+  static char line;
+
+  vreg(0x00);
+  *videoram = BAT_VADDR;
+  vreg(0x02);
+  for(split = 1; split <= 7; split++)
+    {
+      for(pattern = 0; pattern < 4; pattern++)
+        {
+          for(line = 0; line < 8; line++)
+            {
+              if(line < split)
+                *videoram = ((pattern & 0x02) ? 0x00FF : 0x0000);
+              else
+                *videoram = ((pattern & 0x01) ? 0x00FF : 0x0000);
+            }
+          for(line = 0; line < 8; line++)
+            *videoram = 0x0000;
+        }
+    }
+
+  cls(BAT_BLANK);
+}
+
+/*
+  Blank the BAT where clear_rows / clear_cols say something was drawn
+  (see sprite.c) and reset them.
+*/
+void
+bat_clear(void)
+{
+  static char ty;
+  static char col;
+  static char i;
+
+  for(ty = 0; ty < PAGE_ROWS; ty++)
+    {
+      if(!bat_row_used(clear_rows,ty))
+        continue;
+      for(col = 0; col < 8; col++)
+        {
+          if(!(clear_cols & sprite_bit[col]))
+            continue;
+          vreg(0x00);
+          *videoram = ((ty << 6) + (col << 3));
+          vreg(0x02);
+          for(i = 0; i < 8; i++)
+            *videoram = BAT_BLANK;
+        }
+    }
+
+  memset(clear_rows,0,sizeof(clear_rows));
+  clear_cols = 0;
+}
+
+/*
+  Whether tile row ty shows either of its two rows in rows, a bit per
+  row as in used_rows.
+*/
+char
+bat_row_used(unsigned char *rows,
+             char           ty)
+{
+  static unsigned char y;
+
+  y = bat_top[ty];
+  if(rows[(y >> 3)] & sprite_bit[(y & 0x07)])
+    return 1;
+  y++;
+  return (rows[(y >> 3)] & sprite_bit[(y & 0x07)]);
+}
+
+static
+void
+bat_tile(char x,
+         char ty)
+{
+  static unsigned char  row;
+  static unsigned char  col;
+  static unsigned char  bit;
+  static unsigned int   entry;
+
+  row   = (bat_top[ty] << 3);
+  col   = (x >> 3);
+  bit   = sprite_bit[(x & 0x07)];
+  entry = bat_split[ty];
+  if(shadow[(row | col)] & bit)
+    entry |= 0x02;
+  if(shadow[((row + 8) | col)] & bit)
+    entry |= 0x01;
+
+  setword(((ty << 6) + x),entry);
+}
+
+/*
+  Redraw pixel (x, y) from shadow.
+*/
+void
+bat_pixel(char x,
+          char y)
+{
+  bat_tile(x,bat_ty0[y]);
+  if(bat_ty1[y] != bat_ty0[y])
+    bat_tile(x,bat_ty1[y]);
+}
@@ -0,0 +1,526 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2014 Antonio SJ Musumeci <trapexit@spawn.link>
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+/*
+  Benchmarks
+
+  Built by `make bench` (CHIP8_BENCH) into chipce8-bench.pce which
+  runs these instead of the menu. Each case is called BENCH_CALLS
+  times between two vsyncs and timed in frames. One frame is 119318
+  cycles so with 11932 calls every frame works out to 10 cycles a
+  call. The empty loop is subtracted, so the numbers are the cost of
+  the call from C including argument setup, to within 10 cycles.
+  Cases too slow for that are run 1/8th or 1/64th as many times and
+  are good to 80 or 640 cycles.
+*/
+
+#define BENCH_CALLS 11932
+
+static unsigned char bench_row;
+static unsigned char bench_frame;
+static unsigned char bench_empty;
+static unsigned int  bench_word;
+static char          bench_buf[5];
+static char          bench_pixel;
+static char          bench_sprite[32];
+
+static const char *bench_videoram_l = 0x0002;
+static const char *bench_videoram_h = 0x0003;
+
+/* The C conversions arith.c replaced. */
+static
+void
+bench_bcd8_c(unsigned char  num,
+             char          *dest)
+{
+  dest[0] = (num / 100);
+  dest[1] = ((num % 100) / 10);
+  dest[2] = (num % 10);
+}
+
+static
+void
+bench_bcd16_c(unsigned int  num,
+              char         *dest)
+{
+  dest[0] = (num / 10000);
+  dest[1] = ((num % 10000) / 1000);
+  dest[2] = ((num % 1000) / 100);
+  dest[3] = ((num % 100) / 10);
+  dest[4] = (num % 10);
+}
+
+/* The C pixel writer setpixel replaced. */
+static
+void
+bench_setpixel_c(const int addr,
+                 char      val)
+{
+  vreg(0x00);
+  *videoram = addr;
+  vreg(0x02);
+
+  *bench_videoram_l = (val ? 0xFF : 0x00);
+  switch(addr & 0x07)
+    {
+    default:
+    case 0:
+    case 1:
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      break;
+
+    case 2:
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      vreg(0x00,addr+1022);
+      vreg(0x02);
+      *bench_videoram_h = 0x00;
+      break;
+
+    case 3:
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      vreg(0x00,addr+1021);
+      vreg(0x02);
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      break;
+
+    case 4:
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      vreg(0x00,addr+1020);
+      vreg(0x02);
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      break;
+
+    case 5:
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      vreg(0x00,addr+1019);
+      vreg(0x02);
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      break;
+
+    case 6:
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      vreg(0x00,addr+1018);
+      vreg(0x02);
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      break;
+
+    case 7:
+      *bench_videoram_h = 0x00;
+      vreg(0x00,addr+1017);
+      vreg(0x02);
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      *bench_videoram_h = 0x00;
+      break;
+    }
+}
+
+/* chip8_flush_display for the tile renderer with bench_setpixel_c. */
+static
+void
+bench_flush_c(void)
+{
+  static unsigned char  row;
+  static unsigned char  col;
+  static unsigned char  idx;
+  static unsigned char  bits;
+  static char           j;
+  static int            baseaddr;
+
+  for(row = 0; row < 32; row++)
+    {
+      if(!(dirty_rows[(row >> 3)] & sprite_bit[(row & 0x07)]))
+        continue;
+      for(col = 0; col < 8; col++)
+        {
+          idx        = ((row << 3) | col);
+          bits       = dirty[idx];
+          dirty[idx] = 0;
+          baseaddr   = (yaddr[row] + (col << 7));
+          for(j = 0; bits; j++, bits <<= 1)
+            {
+              if(bits & 0x80)
+                bench_setpixel_c((baseaddr + (j << 4)),(shadow[idx] & sprite_bit[j]));
+            }
+        }
+    }
+
+  memset(dirty_rows,0,sizeof(dirty_rows));
+}
+
+static
+void
+bench_sync(void)
+{
+  bench_frame = frames;
+  while(bench_frame == frames)
+    ;
+  bench_frame = frames;
+}
+
+static
+unsigned char
+bench_frames(void)
+{
+  return (frames - bench_frame);
+}
+
+static
+void
+bench_report_n(char          *name,
+               unsigned char  div)
+{
+  static unsigned char elapsed;
+
+  elapsed = (bench_frames() - (bench_empty / div));
+
+  put_string(name,0,bench_row);
+  put_number((elapsed * 10 * div),5,16,bench_row);
+  bench_row++;
+}
+
+static
+void
+bench_report(char *name)
+{
+  bench_report_n(name,1);
+}
+
+/*
+  Flip a pixel at a time through DXYN's path, shadow to VRAM, with
+  the given renderer.
+*/
+static
+void
+bench_pixels(char *name,
+             char  mode)
+{
+  static unsigned int i;
+
+  chip8_set_display(mode);
+  chip8_display_init();
+
+  bench_sync();
+  for(i = 0; i < (BENCH_CALLS / 8); i++)
+    {
+      chip8_put_sprite(&bench_pixel,i,(i >> 6),1);
+      chip8_flush_display();
+    }
+  bench_report_n(name,8);
+}
+
+/*
+  An 8x4 DXYN, 32 pixels, drawn and flushed to VRAM by the tile
+  renderer with the C and the assembly pixel writer, then the same
+  and a 16x16 DXY0 in hires and the same in 64x64, which write VRAM
+  as they draw.
+*/
+static
+void
+bench_dxyn(void)
+{
+  static unsigned int i;
+
+  chip8_set_display(DISPLAY_TILES);
+  chip8_display_init();
+  memset(bench_sprite,0xFF,sizeof(bench_sprite));
+
+  bench_sync();
+  for(i = 0; i < (BENCH_CALLS / 64); i++)
+    {
+      chip8_put_sprite(bench_sprite,(i & 0x38),(i & 0x1C),4);
+      bench_flush_c();
+    }
+  bench_report_n("DXYN 8x4 C",64);
+
+  bench_sync();
+  for(i = 0; i < (BENCH_CALLS / 64); i++)
+    {
+      chip8_put_sprite(bench_sprite,(i & 0x38),(i & 0x1C),4);
+      chip8_flush_display();
+    }
+  bench_report_n("DXYN 8x4 asm",64);
+
+  chip8_set_hires(1);
+  bench_sync();
+  for(i = 0; i < (BENCH_CALLS / 64); i++)
+    chip8_put_hires(bench_sprite,(i & 0x78),(i & 0x3C),4);
+  bench_report_n("DXYN 8x4 hires",64);
+
+  bench_sync();
+  for(i = 0; i < (BENCH_CALLS / 64); i++)
+    chip8_put_hires(bench_sprite,(i & 0x78),(i & 0x30),0);
+  bench_report_n("DXY0 hires",64);
+  chip8_set_hires(0);
+
+  tall = 1;
+  chip8_display_init();
+  bench_sync();
+  for(i = 0; i < (BENCH_CALLS / 64); i++)
+    chip8_put_tall(bench_sprite,(i & 0x38),(i & 0x3C),4);
+  bench_report_n("DXYN 8x4 64x64",64);
+  tall = 0;
+  chip8_display_init();
+}
+
+/*
+  Hires scrolling, which only has to clear what scrolls off.
+*/
+static
+void
+bench_scroll(void)
+{
+  static unsigned int i;
+
+  chip8_set_hires(1);
+
+  bench_sync();
+  for(i = 0; i < (BENCH_CALLS / 64); i++)
+    chip8_scroll(4,0);
+  bench_report_n("00FB hires",64);
+
+  bench_sync();
+  for(i = 0; i < (BENCH_CALLS / 64); i++)
+    chip8_scroll(0,4);
+  bench_report_n("00C4 hires",64);
+
+  chip8_set_hires(0);
+}
+
+/*
+  Fade out a pixel erased on the last row, where ghost_retire() has
+  to stop at the end of the shadow, and show whether the flush after
+  the fade wrote the ghost off.
+*/
+static
+void
+bench_fade(void)
+{
+  chip8_set_display(DISPLAY_FADE);
+  chip8_display_init();
+
+  chip8_put_sprite(&bench_pixel,0,31,1);
+  chip8_flush_display();
+  chip8_put_sprite(&bench_pixel,0,31,1);
+  chip8_flush_display();
+  while(ghost_level)
+    vsync();
+  chip8_flush_display();
+
+  put_string("Fade row 31",0,bench_row);
+  put_string(((ghost_rows[3] | ghost_bits[0xF8]) ? "FAIL" : "ok"),16,bench_row);
+  bench_row++;
+
+  chip8_set_display(DISPLAY_TILES);
+  chip8_display_init();
+}
+
+/*
+  8XY4 with a carry out. The loop adds 20 to F0 16 times and then
+  halts, which should leave V0 at 10 and VF at 1. It is run by the
+  interpreter and, in CD builds, by the block translator once the
+  loop is hot and by the same blocks translated ahead of time. The
+  image is tools/translate-roms' output for the loop.
+*/
+static const unsigned char bench_add_rom[18] =
+  {
+    0x6E, 0x10, 0x6F, 0x00, 0x60, 0xF0, 0x61, 0x20, 0x80, 0x14,
+    0x7E, 0xFF, 0x3E, 0x00, 0x12, 0x02, 0x12, 0x10
+  };
+
+#ifdef CHIP8_SCD
+static const unsigned char bench_add_aot[116] =
+  {
+    0x00, 0x02, 0x02, 0x0E, 0x02, 0xAD, 0x60, 0x38, 0xE9, 0x06,
+    0x8D, 0x60, 0xB0, 0x03, 0xCE, 0x61, 0xA9, 0x00, 0x8D, 0x0F,
+    0xA9, 0xF0, 0x8D, 0x00, 0xA9, 0x20, 0x8D, 0x01, 0x18, 0xAD,
+    0x00, 0x6D, 0x01, 0x8D, 0x00, 0x62, 0x2A, 0x8D, 0x0F, 0x18,
+    0xAD, 0x0E, 0x69, 0xFF, 0x8D, 0x0E, 0xC9, 0x00, 0xF0, 0x18,
+    0xAD, 0x61, 0x30, 0x08, 0x0D, 0x60, 0xF0, 0x03, 0x4C, 0x5C,
+    0x00, 0xA9, 0x0E, 0x8D, 0x40, 0xA9, 0x02, 0x8D, 0x41, 0x60,
+    0xA9, 0x10, 0x8D, 0x40, 0xA9, 0x02, 0x8D, 0x41, 0x60, 0x00,
+    0x0E, 0x02, 0x10, 0x02, 0xAD, 0x60, 0x38, 0xE9, 0x01, 0x8D,
+    0x60, 0xB0, 0x03, 0xCE, 0x61, 0xAD, 0x61, 0x30, 0x08, 0x0D,
+    0x60, 0xF0, 0x03, 0x4C, 0x00, 0x00, 0xA9, 0x02, 0x8D, 0x40,
+    0xA9, 0x02, 0x8D, 0x41, 0x60, 0xFF
+  };
+#endif
+
+static
+void
+bench_add(char *name)
+{
+  static unsigned char i;
+
+  for(i = 0; i < sizeof(bench_add_rom); i++)
+    RAM[0x200 + i] = bench_add_rom[i];
+  memset(v,0,sizeof(v));
+  cache_flush();
+  PC = 0x200;
+  for(i = 0; (i < 64) && (PC != 0x210); i++)
+    chip8_run(16);
+
+  put_string(name,0,bench_row);
+  put_string((((v[0] == 0x10) && (v[0xF] == 1)) ? "ok" : "FAIL"),16,bench_row);
+  bench_row++;
+}
+
+static
+void
+bench_8xy4(void)
+{
+#ifdef CHIP8_SCD
+  static unsigned char i;
+#endif
+
+  jit_init();
+  jit = 0;
+  bench_add("8XY4 interp");
+
+#ifdef CHIP8_SCD
+  jit = 1;
+  bench_add("8XY4 JIT");
+
+  jit_init();
+  for(i = 0; i < sizeof(bench_add_aot); i++)
+    jit_buf[JIT_SIZE - sizeof(bench_add_aot) + i] = bench_add_aot[i];
+  jit_load(sizeof(bench_add_aot));
+  bench_add("8XY4 AOT");
+#endif
+}
+
+void
+bench(void)
+{
+  static unsigned int i;
+
+  irq_add_vsync_handler(chip8_vsync_hook);
+  irq_enable_user(IRQ_VSYNC);
+
+  put_string("Cycles per call",0,0);
+  bench_row = 2;
+
+  bench_sync();
+  for(i = 0; i < BENCH_CALLS; i++)
+    bench_word = i;
+  bench_empty = bench_frames();
+
+  bench_sync();
+  for(i = 0; i < BENCH_CALLS; i++)
+    bench_bcd8_c(i,bench_buf);
+  bench_report("FX33 C");
+
+  bench_sync();
+  for(i = 0; i < BENCH_CALLS; i++)
+    arith_bcd8(bench_buf,i);
+  bench_report("FX33 table");
+
+  bench_sync();
+  for(i = 0; i < BENCH_CALLS; i++)
+    bench_bcd16_c(i,bench_buf);
+  bench_report("9XY3 C");
+
+  bench_sync();
+  for(i = 0; i < BENCH_CALLS; i++)
+    arith_bcd16(bench_buf,i);
+  bench_report("9XY3 table");
+
+  bench_sync();
+  for(i = 0; i < BENCH_CALLS; i++)
+    bench_word = ((unsigned char)i * (unsigned char)(i >> 3));
+  bench_report("9XY1 C");
+
+  bench_sync();
+  for(i = 0; i < BENCH_CALLS; i++)
+    bench_word = arith_mul(i,(i >> 3));
+  bench_report("9XY1 table");
+
+  bench_sync();
+  for(i = 0; i < BENCH_CALLS; i++)
+    bench_word = (((unsigned char)i / (unsigned char)((i >> 3) | 1)) |
+                  (((unsigned char)i % (unsigned char)((i >> 3) | 1)) << 8));
+  bench_report("9XY2 C");
+
+  bench_sync();
+  for(i = 0; i < BENCH_CALLS; i++)
+    bench_word = arith_div(i,((i >> 3) | 1));
+  bench_report("9XY2 shift");
+
+  bench_sync();
+  for(i = 0; i < BENCH_CALLS; i++)
+    bench_word = ((char)rand() & 0xFF);
+  bench_report("CXNN rand");
+
+  rng_init();
+  bench_sync();
+  for(i = 0; i < BENCH_CALLS; i++)
+    bench_word = rng_and(0xFF);
+  bench_report("CXNN xorshift");
+
+  bench_pixel = 0x80;
+  bench_pixels("Pixel tiles",DISPLAY_TILES);
+  bench_pixels("Pixel BAT",DISPLAY_BAT);
+  bench_pixels("Pixel fade",DISPLAY_FADE);
+  bench_dxyn();
+  bench_scroll();
+  bench_fade();
+  bench_8xy4();
+
+  while(1)
+    vsync();
+}
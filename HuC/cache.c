@@ -0,0 +1,134 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2014 Antonio SJ Musumeci <trapexit@spawn.link>
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+
+/*
+  Predecoded instruction cache
+
+  Direct mapped on the instruction's address. Each entry holds the
+  handler resolved through the dispatch tables along with the operand
+  fields and the skip target so they are only extracted once rather
+  than on every execution. Entries are tagged with the address they
+  were decoded from; an opcode can start on an odd address so the
+  odd and even halves of a word share an entry.
+
+  Anything which writes to CHIP-8 RAM while running must call
+  cache_invalidate() for the range written. That also takes care of
+  the block translator in jit.c.
+
+  CD builds only. At 13 bytes an entry even a small cache doesn't fit
+  in a HuCard's 8K of base RAM next to CHIP-8 RAM and the display, so
+  there chip8_run decodes each opcode as it goes and cache_flush() and
+  cache_invalidate() do nothing. Fusion (fuse.c) and the idle loop
+  entries (idle.c) rewrite cache entries so they go with it.
+*/
+
+#ifdef CHIP8_SCD
+
+#define CACHE_ENTRIES 2048
+
+#define CACHE_MASK  (CACHE_ENTRIES - 1)
+#define CACHE_EMPTY 0xFFFF
+#define CACHE_SPAN  6
+
+unsigned int  cache_tag[CACHE_ENTRIES];
+chip8_op_t    cache_op[CACHE_ENTRIES];
+unsigned char cache_x[CACHE_ENTRIES];
+unsigned char cache_y[CACHE_ENTRIES];
+unsigned char cache_n[CACHE_ENTRIES];
+unsigned char cache_nn[CACHE_ENTRIES];
+unsigned int  cache_nnn[CACHE_ENTRIES];
+unsigned int  cache_skip[CACHE_ENTRIES];
+unsigned char cache_len[CACHE_ENTRIES];
+
+void
+cache_flush(void)
+{
+  memset(cache_tag,0xFF,sizeof(cache_tag));
+}
+
+void
+cache_fill(unsigned int  addr,
+           unsigned int  idx)
+{
+  opcode.byte.high = RAM[addr];
+  opcode.byte.low  = RAM[addr+1];
+
+  cache_tag[idx]  = addr;
+  cache_op[idx]   = chip8_lookup();
+  cache_x[idx]    = (opcode.byte.high & 0x0F);
+  cache_y[idx]    = (opcode.byte.low >> 4);
+  cache_n[idx]    = (opcode.byte.low & 0x0F);
+  cache_nn[idx]   = opcode.byte.low;
+  cache_nnn[idx]  = (opcode.word & 0x0FFF);
+  cache_skip[idx] = (addr + 4);
+  cache_len[idx]  = 1;
+
+  if(fuse)
+    fuse_entry(addr,idx);
+  if(idle)
+    idle_entry(addr,idx);
+}
+
+/*
+  Drop every entry whose opcodes overlap [addr,addr+len). An entry
+  can cover up to CACHE_SPAN bytes so the scan starts that far back.
+*/
+void
+cache_invalidate(unsigned int  addr,
+                 unsigned char len)
+{
+  static unsigned int end;
+  static unsigned int idx;
+
+  end = addr + len;
+  if(addr >= (CACHE_SPAN - 1))
+    addr -= (CACHE_SPAN - 1);
+  else
+    addr = 0;
+
+  for(; addr < end; addr++)
+    {
+      idx = ((addr >> 1) & CACHE_MASK);
+      if(cache_tag[idx] == addr)
+        cache_tag[idx] = CACHE_EMPTY;
+    }
+
+  jit_invalidate(end - len,len);
+}
+
+#else
+
+void
+cache_flush(void)
+{
+}
+
+void
+cache_invalidate(unsigned int  addr,
+                 unsigned char len)
+{
+}
+
+#endif
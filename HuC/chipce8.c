@@ -25,20 +25,44 @@
 #include "huc.h"
 #include "menu.c"
 #include "emulator.c"
+#ifdef CHIP8_SCD
+#include "aot.c"
+#endif
 #include "screen.c"
 
+#ifdef CHIP8_BENCH
+#include "bench.c"
+#endif
+
 void
 main(void)
 {
   int romidx;
 
+  chip8_set_ipf(DEFAULT_IPF);
+
+#if defined(CHIP8_REPLAY) || defined(CHIP8_BENCH)
+  rng_fixed = 1;
+#endif
+
+#ifdef CHIP8_BENCH
+  chip8_init();
+  setup_screen(384);
+  bench();
+#endif
+
   while(1)
     {
       chip8_init();
 
       setup_screen(384);
       romidx = menu();
-      chip8_load_rom(&RAM[0x200],romidx);
+      chip8_set_type(rom_types[romidx]);
+      chip8_load_rom(&RAM[PC],romidx);
+      chip8_check_boot();
+#ifdef CHIP8_SCD
+      jit_load(chip8_load_aot(romidx));
+#endif
 
       setup_screen(512);
       chip8();
@@ -0,0 +1,201 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2014 Antonio SJ Musumeci <trapexit@spawn.link>
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+/*
+  CHIP-8X color
+
+  The VIP's color board colors the display in zones: BXY0 8x4 pixel
+  zones, 8 across and 8 down, and BXYN 8x1 zones. Pixels are drawn
+  in the zone's color and the rest is the background color, which
+  02A0 steps through blue, black, green and red.
+
+  None of that touches the tiles. Each of the 8 colors has its own
+  sub-palette, COLOR_PAL + the color, laid out like palette 0 (see
+  page_palette in screen.c) but lit in that color, and a zone is
+  colored by pointing the palette bits of its BAT entries at it. A
+  CHIP-8 pixel is a tile wide so a zone is 8 or 1 BAT entries across,
+  and the entries of the tile rows any of its rows touch going down.
+  The background is VCE color 0, which shows through every
+  sub-palette's color 0.
+
+  The BAT entries start at palette 0 so every zone starts white.
+  Only the tile renderer's BAT, which DISPLAY_FADE shares, is laid
+  out for this; with the other renderers the color opcodes are
+  ignored.
+*/
+
+#define COLOR_PAL 8
+
+const unsigned int color_bg_rgb[4] =
+  {
+    0x0007, /* blue  */
+    0x0000, /* black */
+    0x01C0, /* green */
+    0x0038  /* red   */
+  };
+
+/*
+  The color sub-palettes for each page, loaded in one go by
+  chip8x_show_page(): as in page_palette, page 0 lights the entries
+  with bitplane 0 set and page 1 those with bitplane 2.
+*/
+const unsigned int color_page_palette[256] =
+  {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  /* black */
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0038,0x0000,0x0038,0x0000,0x0038,0x0000,0x0038,  /* red */
+    0x0000,0x0038,0x0000,0x0038,0x0000,0x0038,0x0000,0x0038,
+    0x0000,0x0007,0x0000,0x0007,0x0000,0x0007,0x0000,0x0007,  /* blue */
+    0x0000,0x0007,0x0000,0x0007,0x0000,0x0007,0x0000,0x0007,
+    0x0000,0x003F,0x0000,0x003F,0x0000,0x003F,0x0000,0x003F,  /* violet */
+    0x0000,0x003F,0x0000,0x003F,0x0000,0x003F,0x0000,0x003F,
+    0x0000,0x01C0,0x0000,0x01C0,0x0000,0x01C0,0x0000,0x01C0,  /* green */
+    0x0000,0x01C0,0x0000,0x01C0,0x0000,0x01C0,0x0000,0x01C0,
+    0x0000,0x01F8,0x0000,0x01F8,0x0000,0x01F8,0x0000,0x01F8,  /* yellow */
+    0x0000,0x01F8,0x0000,0x01F8,0x0000,0x01F8,0x0000,0x01F8,
+    0x0000,0x01C7,0x0000,0x01C7,0x0000,0x01C7,0x0000,0x01C7,  /* aqua */
+    0x0000,0x01C7,0x0000,0x01C7,0x0000,0x01C7,0x0000,0x01C7,
+    0x0000,0x01FF,0x0000,0x01FF,0x0000,0x01FF,0x0000,0x01FF,  /* white */
+    0x0000,0x01FF,0x0000,0x01FF,0x0000,0x01FF,0x0000,0x01FF,
+
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  /* black */
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0038,0x0038,0x0038,0x0038,  /* red */
+    0x0000,0x0000,0x0000,0x0000,0x0038,0x0038,0x0038,0x0038,
+    0x0000,0x0000,0x0000,0x0000,0x0007,0x0007,0x0007,0x0007,  /* blue */
+    0x0000,0x0000,0x0000,0x0000,0x0007,0x0007,0x0007,0x0007,
+    0x0000,0x0000,0x0000,0x0000,0x003F,0x003F,0x003F,0x003F,  /* violet */
+    0x0000,0x0000,0x0000,0x0000,0x003F,0x003F,0x003F,0x003F,
+    0x0000,0x0000,0x0000,0x0000,0x01C0,0x01C0,0x01C0,0x01C0,  /* green */
+    0x0000,0x0000,0x0000,0x0000,0x01C0,0x01C0,0x01C0,0x01C0,
+    0x0000,0x0000,0x0000,0x0000,0x01F8,0x01F8,0x01F8,0x01F8,  /* yellow */
+    0x0000,0x0000,0x0000,0x0000,0x01F8,0x01F8,0x01F8,0x01F8,
+    0x0000,0x0000,0x0000,0x0000,0x01C7,0x01C7,0x01C7,0x01C7,  /* aqua */
+    0x0000,0x0000,0x0000,0x0000,0x01C7,0x01C7,0x01C7,0x01C7,
+    0x0000,0x0000,0x0000,0x0000,0x01FF,0x01FF,0x01FF,0x01FF,  /* white */
+    0x0000,0x0000,0x0000,0x0000,0x01FF,0x01FF,0x01FF,0x01FF
+  };
+
+unsigned char chip8x;
+unsigned char color_bg;
+
+/*
+  Point BAT entries tx0 to tx1 of tile rows ty0 to ty1 at the
+  sub-palette of color c.
+*/
+static
+void
+color_fill(unsigned char tx0,
+           unsigned char tx1,
+           unsigned char ty0,
+           unsigned char ty1,
+           unsigned char c)
+{
+  static unsigned int  entry;
+  static unsigned char tx;
+
+  for(; ty0 <= ty1; ty0++)
+    {
+      entry = (((COLOR_PAL + c) << 12) | ((0x1000 >> 4) + (ty0 << 6) + tx0));
+      vreg(0x00);
+      *videoram = ((ty0 << 6) + tx0);
+      vreg(0x02);
+      for(tx = tx0; tx <= tx1; tx++)
+        *videoram = entry++;
+    }
+}
+
+/*
+  Color rows r0 to r1 of the zone columns tx0 to tx1 (in pixels).
+  A row is 7 lines, so those are the tile rows from line 7 * r0 to
+  line 7 * r1 + 6.
+*/
+static
+void
+color_rows(unsigned char tx0,
+           unsigned char tx1,
+           unsigned char r0,
+           unsigned char r1,
+           unsigned char c)
+{
+  if((display_mode != DISPLAY_TILES) && (display_mode != DISPLAY_FADE))
+    return;
+
+  if(tx1 > 63)
+    tx1 = 63;
+  if(r1 > 31)
+    r1 = 31;
+  color_fill(tx0,tx1,((r0 * 7) >> 3),(((r1 * 7) + 6) >> 3),(c & 0x07));
+}
+
+/*
+  BXY0. vx holds the first zone across in its low digit and how many
+  more in its high one, vy the same going down.
+*/
+void
+chip8x_color_zone(unsigned char vx,
+                  unsigned char vy,
+                  unsigned char c)
+{
+  color_rows(((vx & 0x07) << 3),
+             ((((vx & 0x07) + ((vx >> 4) & 0x07)) << 3) + 7),
+             ((vy & 0x07) << 2),
+             ((((vy & 0x07) + ((vy >> 4) & 0x07)) << 2) + 3),
+             c);
+}
+
+/*
+  BXYN. The 8 pixel wide zone holding pixel x, rows y to y + n - 1.
+*/
+void
+chip8x_color_rows(unsigned char x,
+                  unsigned char y,
+                  unsigned char n,
+                  unsigned char c)
+{
+  x &= 0x38;
+  y &= 0x1F;
+  color_rows(x,(x + 7),y,(y + n - 1),c);
+}
+
+/*
+  02A0. Step the background color.
+*/
+void
+chip8x_step_background(void)
+{
+  color_bg = ((color_bg + 1) & 0x03);
+  set_color(0,color_bg_rgb[color_bg]);
+}
+
+/*
+  Called by screen_show_page() after palette 0 is set: load the color
+  sub-palettes for page and put the background color back.
+*/
+void
+chip8x_show_page(char page)
+{
+  set_bgpal(COLOR_PAL,&color_page_palette[page ? 128 : 0],8);
+  set_color(0,color_bg_rgb[color_bg]);
+}
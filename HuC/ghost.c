@@ -0,0 +1,207 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2014 Antonio SJ Musumeci <trapexit@spawn.link>
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+/*
+  Phosphor fade
+
+  CHIP-8 games erase a sprite by drawing it again, so a sprite which
+  moves is missing for any frame flushed between the two draws. With
+  display_mode set to DISPLAY_FADE, the tile renderer writes a pixel
+  that turns off with only the page's second bitplane set (0xFF00,
+  XO-CHIP's plane 2) instead of 0. Those palette entries are set to
+  ghost_rgb[ghost_level], and the vsync hook steps ghost_level down,
+  dimming every ghost at once with 4 color writes a frame and no VRAM
+  writes.
+
+  Pixels turned off while a fade is running join it. Once it reaches
+  black, the next flush writes the ghosts still off as 0 so they don't
+  come back with the next fade. ghost_bits (the otherwise unused
+  shadow2) marks them and ghost_rows the rows with any. A pixel
+  redrawn before then is just written as on. A page flip starts over
+  with none.
+
+  It only applies to lowres without XO-CHIP plane 2, CHIP-8X color or
+  MegaChip; otherwise DISPLAY_FADE is the tile renderer.
+*/
+
+const unsigned int ghost_rgb[GHOST_LEVELS + 1] =
+  {
+    0x0000, 0x0049, 0x0092, 0x00DB, 0x016D
+  };
+
+static const int *vce_addr = 0x0402;
+static const int *vce_data = 0x0404;
+
+/*
+  Whether pixels turning off are to be written as ghosts.
+*/
+char
+ghost_active(void)
+{
+  return ((display_mode == DISPLAY_FADE) &&
+          !hires &&
+          !tall &&
+          !mega &&
+          !chip8x &&
+          !(planes_used & 0x02));
+}
+
+/*
+  Palette 0's ghost entries for ghost_page, those with the second
+  bitplane and not the first, to the color for ghost_level. Called by
+  the vsync hook as well, so it takes no arguments, and never from
+  both at once: see ghost_start() and screen_show_page().
+*/
+void
+ghost_palette(void)
+{
+  static char         i;
+  static unsigned int rgb;
+
+  rgb = ghost_rgb[ghost_level];
+  if(ghost_page)
+    {
+      *vce_addr = 8;
+      for(i = 0; i < 4; i++)
+        *vce_data = rgb;
+      return;
+    }
+
+  for(i = 2; i < 16; i += 4)
+    {
+      *vce_addr = i;
+      *vce_data = rgb;
+    }
+}
+
+/*
+  A flush drew ghosts with none fading: start a fade on page, the page
+  drawn to.
+*/
+void
+ghost_start(char page)
+{
+  ghost_hold  = 1;
+  ghost_page  = page;
+  ghost_level = GHOST_LEVELS;
+  ghost_palette();
+  ghost_hold  = 0;
+}
+
+/*
+  Called by screen_show_page(), with ghost_hold set, after palette 0
+  is set.
+*/
+void
+ghost_show_page(char page)
+{
+  ghost_page = page;
+  ghost_palette();
+}
+
+/*
+  Pixel bit of shadow byte idx was just written as a ghost.
+*/
+void
+ghost_add(unsigned char idx,
+          unsigned char bit)
+{
+  static unsigned char row;
+
+  row = (idx >> 3);
+  if(!(ghost_rows[(row >> 3)] & sprite_bit[(row & 0x07)]))
+    {
+      ghost_rows[(row >> 3)] |= sprite_bit[(row & 0x07)];
+      memset(&ghost_bits[(idx & 0xF8)],0,8);
+    }
+
+  ghost_bits[idx] |= bit;
+  ghost_new = 1;
+}
+
+/*
+  Write the ghosts still off in the front page as 0.
+*/
+void
+ghost_retire(void)
+{
+  static unsigned char row;
+  static unsigned char col;
+  static unsigned char idx;
+  static unsigned char bits;
+  static char          j;
+  static int           baseaddr;
+
+  if(!(ghost_rows[0] | ghost_rows[1] | ghost_rows[2] | ghost_rows[3]))
+    return;
+
+  for(row = 0; row < 32; row++)
+    {
+      if(!(ghost_rows[(row >> 3)] & sprite_bit[(row & 0x07)]))
+        continue;
+
+      for(col = 0; col < 8; col++)
+        {
+          idx  = ((row << 3) | col);
+          bits = (ghost_bits[idx] & ~shadow[idx]);
+          ghost_bits[idx] = 0;
+          baseaddr = (yaddr[row] + (col << 7) + page_front);
+          for(j = 0; bits; j++, bits <<= 1)
+            {
+              if(bits & 0x80)
+                setpixel((baseaddr + (j << 4)),0x0000);
+            }
+        }
+    }
+
+  memset(ghost_rows,0,sizeof(ghost_rows));
+}
+
+/*
+  Forget the ghosts, which the page they are in takes with it when it
+  is cleared.
+*/
+void
+ghost_reset(void)
+{
+  ghost_level = 0;
+  ghost_new   = 0;
+  memset(ghost_rows,0,sizeof(ghost_rows));
+}
+
+/*
+  XO-CHIP plane 2 is about to be used: take the ghosts off the display
+  and give its bitplane back to it.
+*/
+void
+ghost_stop(void)
+{
+  if(display_mode != DISPLAY_FADE)
+    return;
+
+  ghost_level = 0;
+  ghost_retire();
+  ghost_reset();
+  screen_show_page(page_front);
+}
@@ -0,0 +1,656 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2014 Antonio SJ Musumeci <trapexit@spawn.link>
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+/*
+  SCHIP hires
+
+  00FF switches to 128x64. Each pixel is 4x3 screen pixels, so the
+  display is 512x192 and sits in the tile renderer's pages from tile
+  row 2 down. A line of a tile holds two pixels, one of the 4 patterns
+  in hires_pattern, and a pixel row is 3 lines of a tile column.
+
+  The display wraps around the 28 tile rows (224 lines) of VRAM and
+  the 64 tile columns, 16 lines above and below it blank, so that the
+  SCHIP scroll opcodes can move it with the VDC's scroll registers
+  instead of redrawing it. Row Y is line hiline[Y] + hires_sy, less
+  224 if past the end, of the tile row at tile_row_addr, and a pair
+  is hires_tx tiles further right. The next pair is 16 words on and
+  the next 8 pixels 64, both wrapping to the start of the tile row,
+  and a row starting on line 6 or 7 carries on into the tile row
+  below, or tile row 0. With no scrolling that's tile row 2 down.
+
+  There is no shadow of the display in hires: at 1024 bytes it doesn't
+  fit in a HuCard's base RAM. A sprite reads the 8 pixels under each
+  of its bytes back from VRAM with hires_read() and writes the pairs
+  it flips straight away, all those of a byte in one hires_byte()
+  call. After a CLS both go to the hidden page, which is shown on the
+  next flush as in lowres. used_rows / used_cols are a bit per tile
+  row and per 16 pixel (8 tile) column group while in hires.
+
+  Hires always uses the tile renderer's layout. Switching between
+  resolutions with the tile renderer is a CLS into an empty page with
+  the whole of the old one queued for clearing. The other renderers
+  start over with a cleared screen.
+*/
+
+const unsigned char hiline[64] =
+  {
+     16,  19,  22,  25,  28,  31,  34,  37,  40,  43,  46,  49,  52,  55,
+     58,  61,  64,  67,  70,  73,  76,  79,  82,  85,  88,  91,  94,  97,
+    100, 103, 106, 109, 112, 115, 118, 121, 124, 127, 130, 133, 136, 139,
+    142, 145, 148, 151, 154, 157, 160, 163, 166, 169, 172, 175, 178, 181,
+    184, 187, 190, 193, 196, 199, 202, 205
+  };
+
+const unsigned int tile_row_addr[PAGE_ROWS] =
+  {
+    0x1000, 0x1400, 0x1800, 0x1C00, 0x2000, 0x2400, 0x2800,
+    0x2C00, 0x3000, 0x3400, 0x3800, 0x3C00, 0x4000, 0x4400,
+    0x4800, 0x4C00, 0x5000, 0x5400, 0x5800, 0x5C00, 0x6000,
+    0x6400, 0x6800, 0x6C00, 0x7000, 0x7400, 0x7800, 0x7C00
+  };
+
+const unsigned char hires_pattern[4] =
+  {
+    0x00, 0x0F, 0xF0, 0xFF
+  };
+
+unsigned char hires_tx;
+unsigned char hires_sy;
+
+/*
+  The assembly routines at the end of the file, declared before the
+  calls to them as HuC needs for fastcalls.
+*/
+#pragma fastcall hires_byte(word di, byte al, byte acc)
+#pragma fastcall hires_read(word acc)
+#pragma fastcall hires_clear_line(word acc)
+#pragma fastcall hires_clear_tiles(word acc)
+
+/*
+  Mark the tile rows and column groups a sprite of s rows and bytes
+  bytes per row at line, byte col covers.
+*/
+static
+void
+hires_mark(unsigned char line,
+           unsigned char s,
+           unsigned char col,
+           unsigned char bytes)
+{
+  static unsigned char ty;
+  static unsigned char n;
+  static unsigned char tile;
+
+  ty = (line >> 3);
+  for(n = (((line & 0x07) + s + s + s + 7) >> 3); n; n--)
+    {
+      used_rows[(ty >> 3)] |= sprite_bit[(ty & 0x07)];
+      if(++ty == PAGE_ROWS)
+        ty = 0;
+    }
+
+  for(; bytes; bytes--, col++)
+    {
+      tile = (((col << 2) + hires_tx) & 0x3F);
+      used_cols |= sprite_bit[(tile >> 3)];
+      used_cols |= sprite_bit[(((tile + 3) & 0x3F) >> 3)];
+    }
+}
+
+/*
+  DXYN in hires. s == 0 is a 16x16 sprite of 2 bytes per row.
+
+  Sprites are clipped at the right and bottom edges rather than
+  wrapped. As in SCHIP 1.1 the result is the number of rows which
+  collided plus the number clipped off the bottom.
+*/
+char
+chip8_put_hires(unsigned char *sprite,
+                char           x,
+                char           y,
+                char           s)
+{
+  static unsigned char  i;
+  static unsigned char  k;
+  static unsigned char  wide;
+  static unsigned char  bytes;
+  static unsigned char  shift;
+  static unsigned char  col;
+  static unsigned char  bits;
+  static unsigned char  val;
+  static unsigned char  hit;
+  static unsigned char  hits;
+  static unsigned char  line;
+  static unsigned int   page;
+  static unsigned int   pixels;
+  static unsigned int   addr;
+  static unsigned char  b[3];
+
+  wide = (s == 0);
+  if(wide)
+    s = 16;
+
+  x     = (x & 0x7F);
+  y     = (y & 0x3F);
+  shift = (x & 0x07);
+  col   = (x >> 3);
+  bytes = (wide ? 3 : 2);
+  if(shift == 0)
+    bytes--;
+  if((col + bytes) > 16)
+    bytes = (16 - col);
+
+  hits = 0;
+  if((y + s) > 64)
+    {
+      hits = ((y + s) - 64);
+      s    = (64 - y);
+    }
+
+  page = page_front;
+  if(page_flip)
+    page ^= 0x08;
+  page += ((((col << 2) + hires_tx) & 0x3F) << 4);
+
+  line = hiline[y];
+  if(line >= (224 - hires_sy))
+    line -= (224 - hires_sy);
+  else
+    line += hires_sy;
+
+  hires_mark(line,s,col,bytes);
+
+  for(i = 0; i < s; i++, y++)
+    {
+      if(wide)
+        {
+          pixels  = ((sprite[0] << 8) | sprite[1]);
+          sprite += 2;
+        }
+      else
+        {
+          pixels = (*sprite++ << 8);
+        }
+
+      if(pixels != 0)
+        {
+          b[2]   = (pixels << (8 - shift));
+          pixels = (pixels >> shift);
+          b[0]   = (pixels >> 8);
+          b[1]   = pixels;
+
+          hit  = 0;
+          addr = (tile_row_addr[(line >> 3)] + (line & 0x07) + page);
+          for(k = 0; k < bytes; k++)
+            {
+              bits = b[k];
+              if(bits != 0)
+                {
+                  val  = hires_read(addr);
+                  hit |= (val & bits);
+                  hires_byte(addr,(val ^ bits),bits);
+                }
+              addr += 64;
+              if((addr & 0x03F0) < 64)
+                addr -= 0x0400;
+            }
+
+          if(hit)
+            hits++;
+        }
+
+      line += 3;
+      if(line >= 224)
+        line -= 224;
+    }
+
+  return hits;
+}
+
+/*
+  CLS in hires. The hidden page is drawn into straight away so it
+  has to be clear now rather than on the flush: what's left of its
+  clearing is finished here. A second CLS before the flush clears
+  what was drawn into it since the first.
+*/
+void
+hires_cls(void)
+{
+  if(page_flip)
+    {
+      memcpy(page_clear_rows,used_rows,sizeof(used_rows));
+      page_clear_cols = used_cols;
+      page_cleared    = 0;
+    }
+  else
+    {
+      clear_rows[0] |= used_rows[0];
+      clear_rows[1] |= used_rows[1];
+      clear_rows[2] |= used_rows[2];
+      clear_rows[3] |= used_rows[3];
+      clear_cols    |= used_cols;
+      page_flip      = 1;
+    }
+
+  while(page_cleared < page_rows)
+    page_clear_next();
+
+  memset(used_rows,0,sizeof(used_rows));
+  used_cols = 0;
+}
+
+/*
+  00FE / 00FF. Both clear the display, even if the resolution
+  doesn't change.
+*/
+void
+chip8_set_hires(char on)
+{
+  if(on == hires)
+    {
+      chip8_cls();
+      return;
+    }
+
+  if(display_mode != DISPLAY_TILES)
+    {
+      chip8_display_stop();
+      hires = on;
+      screen_clear();
+      chip8_display_init();
+      return;
+    }
+
+  if(page_flip && hires)
+    {
+      memcpy(page_clear_rows,used_rows,sizeof(used_rows));
+      page_clear_cols = used_cols;
+      page_cleared    = 0;
+    }
+  while(page_cleared < page_rows)
+    page_clear_next();
+
+  hires = on;
+  hires_scroll_reset();
+  chip8_clear_shadow();
+  memset(clear_rows,0xFF,sizeof(clear_rows));
+  memset(used_rows,0,sizeof(used_rows));
+  clear_cols = 0xFF;
+  used_cols  = 0;
+  page_flip  = 1;
+}
+
+/*
+  Scroll by dx pixels (4 or -4) and dy rows (down if positive).
+
+  Moving the display is a matter of hires_tx / hires_sy and the scroll
+  registers; the only VRAM written is what scrolls off: the 2 tile
+  columns which would otherwise wrap around to the other side and the
+  lines of the rows leaving the top or bottom, which would otherwise
+  show in the blank lines and wrap round into the top or bottom rows.
+  Only the page being drawn into is cleared. The new scroll offsets
+  take effect at the next vsync.
+*/
+void
+hires_scroll(int dx,
+             int dy)
+{
+  static unsigned char  i;
+  static unsigned char  n;
+  static unsigned char  line;
+  static unsigned char  top;
+  static unsigned int   page;
+  static unsigned int   rows;
+
+  page = page_front;
+  if(page_flip)
+    page ^= 0x08;
+
+  if(dx > 0)
+    {
+      hires_tx = ((hires_tx - 2) & 0x3F);
+      hires_clear_tiles(0x1000 + (hires_tx << 4) + page);
+    }
+  else if(dx < 0)
+    {
+      hires_clear_tiles(0x1000 + (hires_tx << 4) + page);
+      hires_tx = ((hires_tx + 2) & 0x3F);
+    }
+
+  if(dy != 0)
+    {
+      n = (dy > 0 ? dy : -dy);
+      if(n > 64)
+        n = 64;
+      n = (n + n + n);
+      if(dy > 0)
+        {
+          hires_sy = ((hires_sy >= n) ? (hires_sy - n) : (hires_sy + 224 - n));
+          line     = ((hires_sy >= 16) ? (hires_sy - 16) : (hires_sy + 208));
+        }
+      else
+        {
+          line     = ((hires_sy >= 208) ? (hires_sy - 208) : (hires_sy + 16));
+          hires_sy = ((hires_sy + n) < 224 ? (hires_sy + n) : (hires_sy + n - 224));
+        }
+
+      for(i = 0; i < n; i++)
+        {
+          hires_clear_line(tile_row_addr[(line >> 3)] + (line & 0x07) + page);
+          if(++line == 224)
+            line = 0;
+        }
+    }
+
+  memset(used_rows,0xFF,sizeof(used_rows));
+  used_cols = 0xFF;
+
+  if(hires_sy == 0)
+    {
+      scroll(0,(hires_tx << 3),0,0,223,0xC0);
+      scroll_disable(1);
+    }
+  else
+    {
+      top = (224 - hires_sy);
+      scroll(0,(hires_tx << 3),hires_sy,0,(top - 1),0xC0);
+      scroll(1,(hires_tx << 3),0,top,223,0xC0);
+    }
+}
+
+/*
+  Whether tile row ty is set in rows, a bit per tile row.
+*/
+char
+hires_row_used(unsigned char *rows,
+               char           ty)
+{
+  return (rows[(ty >> 3)] & sprite_bit[(ty & 0x07)]);
+}
+
+/*
+  hires_byte(addr, val, bits)
+
+  Write the pixel pairs of val, 8 pixels, which bits has any pixel
+  of, 3 lines each from addr, addr + 16, addr + 32 and addr + 48,
+  wrapping around the tile row and the 28 tile rows as described
+  above. The pattern is latched once per pair and the address only
+  set again when a pair carries on into the next tile row.
+*/
+#asm
+.code
+_hires_byte.3:
+        stx  <__temp+2
+        lda  <_al
+        sta  <__temp+3
+.pair:
+        lda  <__temp+3
+        asl  A
+        rol  A
+        rol  A
+        and  #$03
+        tay
+        asl  <__temp+3
+        asl  <__temp+3
+        lda  <__temp+2
+        asl  <__temp+2
+        asl  <__temp+2
+        and  #$C0
+        beq  .next
+
+        ldx  _hires_pattern,Y
+        lda  #$00
+        sta  <vdc_reg
+        st0  #$00
+        lda  <_di
+        sta  video_data_l
+        lda  <_di+1
+        sta  video_data_h
+        lda  #$02
+        sta  <vdc_reg
+        st0  #$02
+        stx  video_data_l
+
+        lda  <_di
+        and  #$07
+        cmp  #$06
+        bcs  .split
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        bra  .next
+
+.split:
+        st2  #$00
+        cmp  #$06
+        bne  .seek
+        st2  #$00
+.seek:
+        lda  #$00
+        sta  <vdc_reg
+        st0  #$00
+        lda  <_di
+        and  #$F8
+        sta  video_data_l
+        lda  <_di+1
+        clc
+        adc  #$04
+        cmp  #$80
+        bcc  .row
+        sbc  #$70
+.row:
+        sta  video_data_h
+        lda  #$02
+        sta  <vdc_reg
+        st0  #$02
+        stx  video_data_l
+        st2  #$00
+        lda  <_di
+        and  #$07
+        cmp  #$07
+        bne  .next
+        st2  #$00
+
+.next:
+        addw #16,<_di
+        lda  <_di
+        and  #$F0
+        bne  .more
+        lda  <_di+1
+        bit  #$03
+        bne  .more
+        sec
+        sbc  #$04
+        sta  <_di+1
+.more:
+        lda  <__temp+2
+        bne  .pair
+        rts
+#endasm
+
+/*
+  hires_read(addr)
+
+  The 8 pixels hires_byte(addr, ...) would write, read back from the
+  first line of each pair. A pair's pattern has bit 7 set if its left
+  pixel is and bit 0 if its right one is.
+*/
+#asm
+.code
+_hires_read.1:
+        stx  <__temp
+        sta  <__temp+1
+        stz  <__temp+2
+        ldy  #4
+.pair:
+        lda  #$01
+        sta  <vdc_reg
+        st0  #$01
+        lda  <__temp
+        sta  video_data_l
+        lda  <__temp+1
+        sta  video_data_h
+        lda  #$02
+        sta  <vdc_reg
+        st0  #$02
+        lda  video_data_l
+        asl  A
+        rol  <__temp+2
+        and  #$02
+        cmp  #$01
+        rol  <__temp+2
+
+        addw #16,<__temp
+        lda  <__temp
+        and  #$F0
+        bne  .more
+        lda  <__temp+1
+        bit  #$03
+        bne  .more
+        sec
+        sbc  #$04
+        sta  <__temp+1
+.more:
+        dey
+        bne  .pair
+        ldx  <__temp+2
+        cla
+        rts
+#endasm
+
+/*
+  hires_clear_line(addr)
+
+  Zero one line of all 64 tiles in a tile row, addr being the line's
+  word in the first tile: the even tiles and then the odd ones with
+  the address increment at 32.
+
+  hires_clear_tiles(addr)
+
+  Zero 8 words of tile addr and the tile after it, from addr on, in
+  each of the 28 tile rows.
+
+  hires_scroll_reset()
+
+  Back to no scrolling, straight away rather than from the next
+  scroll() display list.
+*/
+void hires_scroll_reset(void);
+
+#asm
+.code
+_hires_clear_line.1:
+        stx  <__temp
+        sta  <__temp+1
+        lda  #$05
+        sta  <vdc_reg
+        st0  #$05
+        st2  #$08
+        ldy  #2
+.run:
+        lda  #$00
+        sta  <vdc_reg
+        st0  #$00
+        lda  <__temp
+        sta  video_data_l
+        lda  <__temp+1
+        sta  video_data_h
+        lda  #$02
+        sta  <vdc_reg
+        st0  #$02
+        st1  #$00
+        ldx  #4
+.words:
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        dex
+        bne  .words
+        lda  <__temp
+        clc
+        adc  #$10
+        sta  <__temp
+        dey
+        bne  .run
+        lda  #$05
+        sta  <vdc_reg
+        st0  #$05
+        st2  #$00
+        rts
+
+_hires_clear_tiles.1:
+        stx  <__temp
+        sta  <__temp+1
+        ldy  #56
+.tile:
+        lda  #$00
+        sta  <vdc_reg
+        st0  #$00
+        lda  <__temp
+        sta  video_data_l
+        lda  <__temp+1
+        sta  video_data_h
+        lda  #$02
+        sta  <vdc_reg
+        st0  #$02
+        st1  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        tya
+        lsr  A
+        bcs  .next_row
+        addw #16,<__temp
+        bra  .done
+.next_row:
+        addw #$03F0,<__temp
+.done:
+        dey
+        bne  .tile
+        rts
+
+_hires_scroll_reset:
+        stz  _hires_tx
+        stz  _hires_sy
+        lda  scroll_cr
+        and  #$FE
+        sta  scroll_cr
+        lda  scroll_cr+1
+        and  #$FE
+        sta  scroll_cr+1
+        stwz bg_x1
+        stwz bg_y1
+        rts
+#endasm
@@ -0,0 +1,140 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2014 Antonio SJ Musumeci <trapexit@spawn.link>
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+
+/*
+  Idle loop detection
+
+  A lot of ROMs spend most of their time spinning on the delay timer
+
+    loop: FX07      LD VX, DT
+          3XNN      SE VX, NN
+          1loop     JP loop
+
+  or halt with a jump to itself. Neither can make progress until the
+  vsync IRQ runs chip8_vsync_hook so rather than re-dispatching the
+  loop thousands of times a frame these entries return IDLE and
+  chip8_loop waits for the next vsync.
+
+  Run by cache_fill() after fuse_entry() so it wins over the plain
+  fused version of the timer poll. A HuCard build has no cache, so
+  op_1nnn() checks its own target with idle_jump() instead.
+*/
+
+#ifdef CHIP8_SCD
+
+/*
+  1NNN - JP NNN where NNN is the address of the JP itself.
+*/
+static
+char
+op_idle_1nnn(void)
+{
+  PC = NNN;
+  return IDLE;
+}
+
+/*
+  FX07 3XNN 1MMM where MMM is the address of the FX07.
+  NN and NNN come from the SE and JP.
+*/
+static
+char
+op_idle_fx07_3xnn(void)
+{
+  v[X] = delay_timer;
+  if(v[X] == NN)
+    {
+      PC = SKIP;
+      return SUCCESS;
+    }
+
+  PC = NNN;
+  return IDLE;
+}
+
+void
+idle_entry(unsigned int addr,
+           unsigned int idx)
+{
+  static unsigned int target;
+
+  if(addr > (sizeof(RAM) - CACHE_SPAN))
+    return;
+
+  switch(RAM[addr] & 0xF0)
+    {
+    case 0x10:
+      target = (((RAM[addr] & 0x0F) << 8) | RAM[addr+1]);
+      if(target != addr)
+        return;
+      cache_op[idx]  = op_idle_1nnn;
+      cache_nnn[idx] = target;
+      cache_len[idx] = 1;
+      break;
+
+    case 0xF0:
+      if(RAM[addr+1] != 0x07)
+        return;
+      if(RAM[addr+2] != (0x30 | (RAM[addr] & 0x0F)))
+        return;
+      if((RAM[addr+4] & 0xF0) != 0x10)
+        return;
+      target = (((RAM[addr+4] & 0x0F) << 8) | RAM[addr+5]);
+      if(target != addr)
+        return;
+      cache_op[idx]   = op_idle_fx07_3xnn;
+      cache_nn[idx]   = RAM[addr+3];
+      cache_nnn[idx]  = target;
+      cache_skip[idx] = (addr + 6);
+      cache_len[idx]  = 3;
+      break;
+    }
+}
+
+#else
+
+/*
+  1NNN that jumps to itself or back to the FX07 of a timer poll that
+  ends in it. PC has already moved past the jump.
+*/
+static
+char
+idle_jump(void)
+{
+  if(NNN == (PC - 2))
+    return IDLE;
+  if(NNN != (PC - 6))
+    return SUCCESS;
+  if((RAM[NNN] & 0xF0) != 0xF0)
+    return SUCCESS;
+  if(RAM[NNN+1] != 0x07)
+    return SUCCESS;
+  if(RAM[NNN+2] != (0x30 | (RAM[NNN] & 0x0F)))
+    return SUCCESS;
+
+  return IDLE;
+}
+
+#endif
@@ -0,0 +1,720 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2014 Antonio SJ Musumeci <trapexit@spawn.link>
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+/*
+  Block translator
+
+  chip8_run calls jit_run() whenever PC lands somewhere other than the
+  next instruction, i.e. at the start of a basic block. Each entry is
+  counted and once an address has been entered JIT_HOT times the run
+  of opcodes starting there is translated to HuC6280 code in jit_buf
+  and called directly from then on.
+
+  Translated: 6XNN 7XNN 8XYN ANNN FX07 FX15 FX1E FX29, ending the
+  block at 1NNN 3XNN 4XNN 5XY0 9XY0. Anything else ends the block and
+  leaves that opcode to the interpreter. Blocks work on v, I and PC in
+  place and take their opcode count from jit_budget. An exit to an
+  address which already has a block jumps straight into it while
+  there is budget left; exits to blocks compiled later are patched
+  when that block is compiled.
+
+  Blocks for a ROM's loops can also be translated ahead of time by
+  tools/translate-roms and are put in place by jit_load(). Once the
+  buffer fills up those are kept and nothing new is compiled.
+
+  Blocks never write CHIP-8 RAM. Writes made by the interpreter come
+  through jit_invalidate(). One which lands on a page holding
+  translated code flushes the whole buffer and marks the page so it
+  is left to the interpreter from then on.
+
+  CD builds only. Its buffer and tables don't fit in a HuCard's 8K of
+  base RAM next to CHIP-8 RAM and the display, so there every block
+  is interpreted and jit_init() does nothing.
+*/
+
+#ifdef CHIP8_SCD
+
+#define JIT_SIZE    4096
+#define JIT_ENTRIES 256
+#define JIT_PATCHES 128
+
+#define JIT_MASK  (JIT_ENTRIES - 1)
+#define JIT_EMPTY 0xFFFF
+#define JIT_HOT   8
+#define JIT_NEVER 0xFF
+#define JIT_BLOCK 32
+#define JIT_ROOM  64
+#define JIT_PAGES 64
+
+#define JIT_CLC     0x18
+#define JIT_SEC     0x38
+#define JIT_CLA     0x62
+#define JIT_ASL_A   0x0A
+#define JIT_ROL_A   0x2A
+#define JIT_RTS     0x60
+#define JIT_LDA_IMM 0xA9
+#define JIT_AND_IMM 0x29
+#define JIT_ADC_IMM 0x69
+#define JIT_SBC_IMM 0xE9
+#define JIT_CMP_IMM 0xC9
+#define JIT_LDA     0xAD
+#define JIT_STA     0x8D
+#define JIT_STZ     0x9C
+#define JIT_ADC     0x6D
+#define JIT_SBC     0xED
+#define JIT_ORA     0x0D
+#define JIT_AND     0x2D
+#define JIT_EOR     0x4D
+#define JIT_CMP     0xCD
+#define JIT_LSR     0x4E
+#define JIT_ASL     0x0E
+#define JIT_JMP     0x4C
+#define JIT_BMI     0x30
+#define JIT_BEQ     0xF0
+#define JIT_BNE     0xD0
+#define JIT_BCS     0xB0
+#define JIT_DEC     0xCE
+
+#define AOT_BLOCK      0x00
+#define AOT_END        0xFF
+#define AOT_SYM_V      0
+#define AOT_SYM_I      1
+#define AOT_SYM_PC     2
+#define AOT_SYM_BUDGET 3
+#define AOT_SYM_DT     4
+#define AOT_SYM_TMP    5
+
+int           jit_budget;
+unsigned int  jit_entry;
+unsigned char jit_tmp;
+unsigned int  jit_pos;
+unsigned char jit_npatch;
+unsigned char jit_aot;
+unsigned char jit_buf[JIT_SIZE];
+unsigned int  jit_tag[JIT_ENTRIES];
+unsigned int  jit_code[JIT_ENTRIES];
+unsigned char jit_hits[JIT_ENTRIES];
+unsigned int  jit_patch_pc[JIT_PATCHES];
+unsigned int  jit_patch_at[JIT_PATCHES];
+unsigned char jit_page[JIT_PAGES];
+unsigned char jit_smc[JIT_PAGES];
+
+#pragma fastcall jit_exec(word acc)
+
+#asm
+.code
+_jit_exec.1:
+     __stw  _jit_entry
+       jmp  [_jit_entry]
+#endasm
+
+void
+jit_flush(void)
+{
+  jit_pos    = 0;
+  jit_npatch = 0;
+  jit_aot    = 0;
+  memset(jit_tag,0xFF,sizeof(jit_tag));
+  memset(jit_page,0,sizeof(jit_page));
+}
+
+void
+jit_init(void)
+{
+  memset(jit_smc,0,sizeof(jit_smc));
+  jit_flush();
+}
+
+/*
+  [addr,addr+len) of CHIP-8 RAM has been written. len is at most 16
+  so it covers two pages at most.
+*/
+void
+jit_invalidate(unsigned int  addr,
+               unsigned char len)
+{
+  static unsigned char first;
+  static unsigned char last;
+
+  first = ((addr >> 6) & (JIT_PAGES - 1));
+  last  = (((addr + len - 1) >> 6) & (JIT_PAGES - 1));
+  if(jit_page[first] | jit_page[last])
+    {
+      jit_smc[first] = 1;
+      jit_smc[last]  = 1;
+      jit_flush();
+    }
+}
+
+static
+void
+jit_byte(unsigned char b)
+{
+  jit_buf[jit_pos++] = b;
+}
+
+static
+void
+jit_abs(unsigned char op,
+        unsigned int  addr)
+{
+  jit_buf[jit_pos++] = op;
+  jit_buf[jit_pos++] = addr;
+  jit_buf[jit_pos++] = (addr >> 8);
+}
+
+static
+void
+jit_imm(unsigned char op,
+        unsigned char val)
+{
+  jit_buf[jit_pos++] = op;
+  jit_buf[jit_pos++] = val;
+}
+
+/*
+  Leave the block for target. Chains into target's block while
+  jit_budget is positive, otherwise stores PC and returns to C. Until
+  target has a block the JMP points at the return path and is queued
+  for patching. 24 bytes.
+*/
+static
+void
+jit_exit(unsigned int target)
+{
+  static unsigned int jidx;
+  static unsigned int ret;
+
+  jidx = ((target >> 1) & JIT_MASK);
+  ret  = ((unsigned int)jit_buf + jit_pos + 13);
+
+  jit_abs(JIT_LDA,(unsigned int)&jit_budget + 1);
+  jit_imm(JIT_BMI,8);
+  jit_abs(JIT_ORA,(unsigned int)&jit_budget);
+  jit_imm(JIT_BEQ,3);
+  if((jit_tag[jidx] == target) && jit_code[jidx])
+    {
+      jit_abs(JIT_JMP,jit_code[jidx]);
+    }
+  else
+    {
+      if(jit_npatch < JIT_PATCHES)
+        {
+          jit_patch_pc[jit_npatch] = target;
+          jit_patch_at[jit_npatch] = (jit_pos + 1);
+          jit_npatch++;
+        }
+      jit_abs(JIT_JMP,ret);
+    }
+
+  jit_imm(JIT_LDA_IMM,target);
+  jit_abs(JIT_STA,(unsigned int)&PC);
+  jit_imm(JIT_LDA_IMM,(target >> 8));
+  jit_abs(JIT_STA,(unsigned int)&PC + 1);
+  jit_byte(JIT_RTS);
+}
+
+/*
+  VF from the carry. When X or Y is F the flag is written first, as
+  the C handlers do, so the result overwrites it.
+*/
+static
+void
+jit_alu(unsigned char op,
+        unsigned int  vd,
+        unsigned int  va,
+        unsigned int  vb,
+        char          early)
+{
+  static unsigned int vf;
+
+  vf = (unsigned int)&v[0xF];
+  if(early)
+    {
+      jit_byte((op == JIT_ADC) ? JIT_CLC : JIT_SEC);
+      jit_abs(JIT_LDA,va);
+      jit_abs(op,vb);
+      jit_byte(JIT_CLA);
+      jit_byte(JIT_ROL_A);
+      jit_abs(JIT_STA,vf);
+    }
+
+  jit_byte((op == JIT_ADC) ? JIT_CLC : JIT_SEC);
+  jit_abs(JIT_LDA,va);
+  jit_abs(op,vb);
+  jit_abs(JIT_STA,vd);
+
+  if(!early)
+    {
+      jit_byte(JIT_CLA);
+      jit_byte(JIT_ROL_A);
+      jit_abs(JIT_STA,vf);
+    }
+}
+
+/*
+  Skip: compare already done, branch on op to the taken exit.
+*/
+static
+void
+jit_skip(unsigned char op,
+         unsigned int  pc)
+{
+  jit_imm(op,24);
+  jit_exit(pc + 2);
+  jit_exit(pc + 4);
+}
+
+/*
+  Translate the block starting at addr into entry jidx. Returns 0 if
+  nothing could be translated or the block is one idle.c handles.
+*/
+static
+char
+jit_compile(unsigned int addr,
+            unsigned int jidx)
+{
+  static unsigned int  pc;
+  static unsigned int  start;
+  static unsigned int  code;
+  static unsigned int  vx;
+  static unsigned int  vy;
+  static unsigned int  idx;
+  static unsigned char n;
+  static unsigned char hi;
+  static unsigned char lo;
+  static unsigned char x;
+  static unsigned char y;
+  static unsigned char end;
+  static unsigned char i;
+
+  if(jit_smc[addr >> 6])
+    return 0;
+
+  idx = ((addr >> 1) & CACHE_MASK);
+  if(cache_tag[idx] != addr)
+    cache_fill(addr,idx);
+  if((cache_op[idx] == op_idle_1nnn) ||
+     (cache_op[idx] == op_idle_fx07_3xnn))
+    return 0;
+
+  if((JIT_SIZE - jit_pos) < (JIT_ROOM * 2))
+    {
+      if(jit_aot)
+        return 0;
+      jit_flush();
+    }
+
+  start = jit_pos;
+  code  = ((unsigned int)jit_buf + start);
+
+  jit_byte(JIT_SEC);
+  jit_abs(JIT_LDA,(unsigned int)&jit_budget);
+  jit_imm(JIT_SBC_IMM,0);
+  jit_abs(JIT_STA,(unsigned int)&jit_budget);
+  jit_abs(JIT_LDA,(unsigned int)&jit_budget + 1);
+  jit_imm(JIT_SBC_IMM,0);
+  jit_abs(JIT_STA,(unsigned int)&jit_budget + 1);
+
+  pc  = addr;
+  n   = 0;
+  end = 0;
+  while(!end)
+    {
+      if((n == JIT_BLOCK) ||
+         ((JIT_SIZE - jit_pos) < JIT_ROOM) ||
+         (pc >= 0x0FFF) ||
+         jit_smc[pc >> 6])
+        {
+          jit_exit(pc);
+          break;
+        }
+
+      hi = RAM[pc];
+      lo = RAM[pc+1];
+      x  = (hi & 0x0F);
+      y  = (lo >> 4);
+      vx = (unsigned int)&v[x];
+      vy = (unsigned int)&v[y];
+      n++;
+
+      switch(hi >> 4)
+        {
+        case 0x1:
+          jit_exit(((hi & 0x0F) << 8) | lo);
+          end = 1;
+          break;
+
+        case 0x3:
+        case 0x4:
+          jit_abs(JIT_LDA,vx);
+          jit_imm(JIT_CMP_IMM,lo);
+          jit_skip(((hi >> 4) == 0x3) ? JIT_BEQ : JIT_BNE,pc);
+          end = 1;
+          break;
+
+        case 0x5:
+        case 0x9:
+          if((lo & 0x0F) != 0)
+            {
+              n--;
+              jit_exit(pc);
+              end = 1;
+              break;
+            }
+          jit_abs(JIT_LDA,vx);
+          jit_abs(JIT_CMP,vy);
+          jit_skip(((hi >> 4) == 0x5) ? JIT_BEQ : JIT_BNE,pc);
+          end = 1;
+          break;
+
+        case 0x6:
+          jit_imm(JIT_LDA_IMM,lo);
+          jit_abs(JIT_STA,vx);
+          break;
+
+        case 0x7:
+          jit_byte(JIT_CLC);
+          jit_abs(JIT_LDA,vx);
+          jit_imm(JIT_ADC_IMM,lo);
+          jit_abs(JIT_STA,vx);
+          break;
+
+        case 0x8:
+          switch(lo & 0x0F)
+            {
+            case 0x0:
+              jit_abs(JIT_LDA,vy);
+              jit_abs(JIT_STA,vx);
+              break;
+            case 0x1:
+              jit_abs(JIT_LDA,vx);
+              jit_abs(JIT_ORA,vy);
+              jit_abs(JIT_STA,vx);
+              break;
+            case 0x2:
+              jit_abs(JIT_LDA,vx);
+              jit_abs(JIT_AND,vy);
+              jit_abs(JIT_STA,vx);
+              break;
+            case 0x3:
+              jit_abs(JIT_LDA,vx);
+              jit_abs(JIT_EOR,vy);
+              jit_abs(JIT_STA,vx);
+              break;
+            case 0x4:
+              jit_alu(JIT_ADC,vx,vx,vy,((x == 0xF) || (y == 0xF)));
+              break;
+            case 0x5:
+              jit_alu(JIT_SBC,vx,vx,vy,((x == 0xF) || (y == 0xF)));
+              break;
+            case 0x7:
+              jit_alu(JIT_SBC,vx,vy,vx,((x == 0xF) || (y == 0xF)));
+              break;
+            case 0x6:
+              jit_abs(JIT_LDA,vx);
+              jit_imm(JIT_AND_IMM,0x01);
+              jit_abs(JIT_STA,(unsigned int)&v[0xF]);
+              jit_abs(JIT_LSR,vx);
+              break;
+            case 0xE:
+              jit_abs(JIT_LDA,vx);
+              jit_byte(JIT_ASL_A);
+              jit_byte(JIT_CLA);
+              jit_byte(JIT_ROL_A);
+              jit_abs(JIT_STA,(unsigned int)&v[0xF]);
+              jit_abs(JIT_ASL,vx);
+              break;
+            default:
+              n--;
+              jit_exit(pc);
+              end = 1;
+              break;
+            }
+          break;
+
+        case 0xA:
+          jit_imm(JIT_LDA_IMM,lo);
+          jit_abs(JIT_STA,(unsigned int)&I);
+          jit_imm(JIT_LDA_IMM,x);
+          jit_abs(JIT_STA,(unsigned int)&I + 1);
+          break;
+
+        case 0xF:
+          switch(lo)
+            {
+            case 0x07:
+              jit_abs(JIT_LDA,(unsigned int)&delay_timer);
+              jit_abs(JIT_STA,vx);
+              break;
+            case 0x15:
+              jit_abs(JIT_LDA,vx);
+              jit_abs(JIT_STA,(unsigned int)&delay_timer);
+              break;
+            case 0x1E:
+              jit_byte(JIT_CLC);
+              jit_abs(JIT_LDA,(unsigned int)&I);
+              jit_abs(JIT_ADC,vx);
+              jit_abs(JIT_STA,(unsigned int)&I);
+              jit_abs(JIT_LDA,(unsigned int)&I + 1);
+              jit_imm(JIT_ADC_IMM,0);
+              jit_abs(JIT_STA,(unsigned int)&jit_tmp);
+              jit_imm(JIT_AND_IMM,0x0F);
+              jit_abs(JIT_STA,(unsigned int)&I + 1);
+              jit_abs(JIT_LDA,(unsigned int)&jit_tmp);
+              jit_imm(JIT_CMP_IMM,0x10);
+              jit_byte(JIT_CLA);
+              jit_byte(JIT_ROL_A);
+              jit_abs(JIT_STA,(unsigned int)&v[0xF]);
+              break;
+            case 0x29:
+              jit_abs(JIT_LDA,vx);
+              jit_imm(JIT_AND_IMM,0x0F);
+              jit_abs(JIT_STA,(unsigned int)&jit_tmp);
+              jit_byte(JIT_ASL_A);
+              jit_byte(JIT_ASL_A);
+              jit_byte(JIT_CLC);
+              jit_abs(JIT_ADC,(unsigned int)&jit_tmp);
+              jit_abs(JIT_STA,(unsigned int)&I);
+              jit_abs(JIT_STZ,(unsigned int)&I + 1);
+              break;
+            default:
+              n--;
+              jit_exit(pc);
+              end = 1;
+              break;
+            }
+          break;
+
+        default:
+          n--;
+          jit_exit(pc);
+          end = 1;
+          break;
+        }
+
+      if(!end)
+        pc += 2;
+    }
+
+  if(n == 0)
+    {
+      jit_pos = start;
+      return 0;
+    }
+
+  jit_buf[start + 5] = n;
+  for(i = (addr >> 6); i <= ((pc + 1) >> 6); i++)
+    jit_page[i & (JIT_PAGES - 1)] = 1;
+
+  jit_tag[jidx]  = addr;
+  jit_code[jidx] = code;
+
+  for(i = 0; i < jit_npatch; )
+    {
+      if(jit_patch_pc[i] == addr)
+        {
+          jit_buf[jit_patch_at[i]]   = code;
+          jit_buf[jit_patch_at[i]+1] = (code >> 8);
+          jit_npatch--;
+          jit_patch_pc[i] = jit_patch_pc[jit_npatch];
+          jit_patch_at[i] = jit_patch_at[jit_npatch];
+        }
+      else
+        {
+          i++;
+        }
+    }
+
+  return 1;
+}
+
+static
+unsigned int
+jit_sym(unsigned char tok)
+{
+  static unsigned int base;
+
+  switch(tok >> 5)
+    {
+    case AOT_SYM_V:
+      base = (unsigned int)&v[0];
+      break;
+    case AOT_SYM_I:
+      base = (unsigned int)&I;
+      break;
+    case AOT_SYM_PC:
+      base = (unsigned int)&PC;
+      break;
+    case AOT_SYM_BUDGET:
+      base = (unsigned int)&jit_budget;
+      break;
+    case AOT_SYM_DT:
+      base = (unsigned int)&delay_timer;
+      break;
+    default:
+      base = (unsigned int)&jit_tmp;
+      break;
+    }
+
+  return (base + (tok & 0x1F));
+}
+
+/*
+  Expand an image from tools/translate-roms, len bytes already copied
+  to the end of jit_buf by chip8_load_aot(). Records are expanded in
+  place from the front of the buffer; the tool makes sure the write
+  position never catches up with the read position. See the tool for
+  the format.
+*/
+void
+jit_load(unsigned int len)
+{
+  static unsigned int  in;
+  static unsigned int  addr;
+  static unsigned int  end;
+  static unsigned int  jidx;
+  static unsigned char op;
+  static unsigned char arg;
+  static unsigned char i;
+
+  if(len == 0)
+    return;
+
+  in = (JIT_SIZE - len);
+  while(1)
+    {
+      op = jit_buf[in++];
+      switch(op)
+        {
+        case AOT_END:
+          jit_aot = 1;
+          return;
+
+        case AOT_BLOCK:
+          addr = (jit_buf[in] | (jit_buf[in+1] << 8));
+          end  = (jit_buf[in+2] | (jit_buf[in+3] << 8));
+          in  += 4;
+
+          jidx = ((addr >> 1) & JIT_MASK);
+          jit_tag[jidx]  = addr;
+          jit_code[jidx] = ((unsigned int)jit_buf + jit_pos);
+          jit_hits[jidx] = 0;
+          for(i = (addr >> 6); i <= ((end - 1) >> 6); i++)
+            jit_page[i & (JIT_PAGES - 1)] = 1;
+          break;
+
+        case JIT_JMP:
+          addr = (jit_buf[in] | (jit_buf[in+1] << 8));
+          in  += 2;
+          jit_abs(op,(unsigned int)jit_buf + addr);
+          break;
+
+        case JIT_LDA:
+        case JIT_STA:
+        case JIT_STZ:
+        case JIT_ADC:
+        case JIT_SBC:
+        case JIT_ORA:
+        case JIT_AND:
+        case JIT_EOR:
+        case JIT_CMP:
+        case JIT_LSR:
+        case JIT_ASL:
+        case JIT_DEC:
+          arg = jit_buf[in++];
+          jit_abs(op,jit_sym(arg));
+          break;
+
+        case JIT_LDA_IMM:
+        case JIT_AND_IMM:
+        case JIT_ADC_IMM:
+        case JIT_SBC_IMM:
+        case JIT_CMP_IMM:
+        case JIT_BMI:
+        case JIT_BEQ:
+        case JIT_BNE:
+        case JIT_BCS:
+          arg = jit_buf[in++];
+          jit_imm(op,arg);
+          break;
+
+        default:
+          jit_byte(op);
+          break;
+        }
+    }
+}
+
+/*
+  PC is the start of a block. Run translated code for as long as there
+  is one for PC and budget left, compiling PC first if it has just
+  become hot. Returns the remaining budget.
+*/
+int
+jit_run(int budget)
+{
+  static unsigned int jidx;
+
+  while(budget > 0)
+    {
+      jidx = ((PC >> 1) & JIT_MASK);
+      if(jit_tag[jidx] != PC)
+        {
+          jit_tag[jidx]  = PC;
+          jit_code[jidx] = 0;
+          jit_hits[jidx] = 0;
+        }
+
+      if(!jit_code[jidx])
+        {
+          if(jit_hits[jidx] == JIT_NEVER)
+            break;
+          if(++jit_hits[jidx] < JIT_HOT)
+            break;
+          if(!jit_compile(PC,jidx))
+            {
+              jit_tag[jidx]  = PC;
+              jit_code[jidx] = 0;
+              jit_hits[jidx] = JIT_NEVER;
+              break;
+            }
+        }
+
+      jit_budget = budget;
+      jit_exec(jit_code[jidx]);
+      budget = jit_budget;
+    }
+
+  return budget;
+}
+
+#else
+
+void
+jit_init(void)
+{
+}
+
+#endif
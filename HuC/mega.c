@@ -0,0 +1,352 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2014 Antonio SJ Musumeci <trapexit@spawn.link>
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+/*
+  MegaChip
+
+  0011 switches to MegaChip's 256x192 mode and 0010 back. In it DXYN
+  draws a sprite of mega_width x mega_height bytes, each a palette
+  index with 0 transparent, VF being set if it covers a pixel of the
+  collision color (09NN). 00E0 shows what was drawn since the last
+  one and starts on a blank screen.
+
+  The screen goes to 256 pixels wide and each pixel is a pixel of a
+  4 bit tile, so a tile row is 32 tiles of the BAT as screen_clear()
+  lays it out. There are two pages, tile columns 0 - 31 and 32 - 63,
+  from tile row 2 down: sprites are drawn into the hidden one and
+  00E0 scrolls it into view and clears the other, only the tile rows
+  drawn in. There isn't the RAM for a copy of the display so drawing
+  reads back the tile lines it changes.
+
+  Tiles have 16 colors, so rather than 255 a ROM gets 15: indexes are
+  given palette 0's entries in the order they are first drawn, from
+  the colors 02NN loaded, and once those run out share them. mega_hw
+  (in display_buf, unused in this mode) holds each index's entry.
+
+  The rest of MegaChip isn't done: CHIP-8 RAM is still 4K so 01NN
+  can only point I into it, and the alpha, blend and sample opcodes
+  (060N, 0700) are ignored, so there is no sound. Of the demos only
+  MegaMaze, MegaSirpinski and Mega Minimal run. The particle and
+  twister demos are 50K and 177K and don't.
+*/
+
+#define MEGA_ADDR   0x1800
+#define MEGA_ROWS   24
+#define MEGA_PAGE   0x0200
+#define MEGA_COLORS 15
+
+#define mega_hw display_buf
+
+unsigned int   mega_width;
+unsigned int   mega_height;
+unsigned char  mega_coll;
+unsigned char  mega_next;
+unsigned char  mega_back;
+unsigned char *mega_pal;
+unsigned char  mega_pal_n;
+unsigned char  mega_used[6];
+
+static unsigned char mega_mask;
+static unsigned char mega_p[4];
+static unsigned char mega_coll_hw;
+
+/* Defined at the end of the file. */
+#pragma fastcall mega_clear_row(word acc)
+
+/*
+  Load palette 0 entry mega_hw[idx] with index idx's color from the
+  palette 02NN loaded, white if it has none.
+*/
+static
+void
+mega_set_color(unsigned char idx)
+{
+  static unsigned char *argb;
+
+  if(idx > mega_pal_n)
+    {
+      set_color(mega_hw[idx],0x01FF);
+      return;
+    }
+
+  argb = &mega_pal[((idx - 1) << 2)];
+  set_color(mega_hw[idx],
+            (((argb[2] >> 5) << 6) | ((argb[1] >> 5) << 3) | (argb[3] >> 5)));
+}
+
+/*
+  The palette 0 entry for index idx, given the next free one the
+  first time it's drawn.
+*/
+static
+unsigned char
+mega_color(unsigned char idx)
+{
+  if(mega_hw[idx])
+    return mega_hw[idx];
+
+  if(mega_next <= MEGA_COLORS)
+    {
+      mega_hw[idx] = mega_next++;
+      mega_set_color(idx);
+    }
+  else
+    {
+      mega_hw[idx] = (((idx - 1) % MEGA_COLORS) + 1);
+    }
+
+  return mega_hw[idx];
+}
+
+/*
+  0011. Clear the screen into the mode with page 0 showing.
+*/
+void
+mega_on(void)
+{
+  chip8_display_stop();
+  ghost_reset();
+  memset(dirty_rows,0,sizeof(dirty_rows));
+  page_flip    = 0;
+  page_cleared = page_rows;
+  screen_clear();
+  set_xres(256);
+  set_color(0,0x0000);
+
+  memset(mega_hw,0,256);
+  memset(mega_used,0,sizeof(mega_used));
+  mega_width  = 256;
+  mega_height = 256;
+  mega_coll   = 0;
+  mega_next   = 1;
+  mega_back   = 1;
+  mega_pal_n  = 0;
+  mega = 1;
+}
+
+/*
+  0010. Back to the CHIP-8 display, cleared.
+*/
+void
+mega_off(void)
+{
+  mega = 0;
+  set_xres(512);
+  screen_clear();
+  chip8_display_init();
+}
+
+/*
+  02NN. Take the palette's n colors from pal, ARGB, for indexes 1 to
+  n, and reload the entries of the indexes already drawn.
+*/
+void
+mega_palette(unsigned char *pal,
+             unsigned char  n)
+{
+  static unsigned char idx;
+
+  mega_pal   = pal;
+  mega_pal_n = n;
+  for(idx = 1; idx != 0; idx++)
+    {
+      if(mega_hw[idx])
+        mega_set_color(idx);
+    }
+}
+
+/*
+  00E0. Show the page drawn into and clear the one that was showing
+  to draw into next. It is cleared straight away so may show for the
+  rest of the frame.
+*/
+void
+mega_cls(void)
+{
+  static unsigned char  ty;
+  static unsigned char *used;
+  static unsigned int   addr;
+
+  scroll(0,(mega_back ? 256 : 0),0,0,223,0xC0);
+
+  mega_back ^= 0x01;
+  used = &mega_used[(mega_back * 3)];
+  addr = (MEGA_ADDR + (mega_back ? MEGA_PAGE : 0));
+  for(ty = 0; ty < MEGA_ROWS; ty++, addr += 0x0400)
+    {
+      if(used[(ty >> 3)] & sprite_bit[(ty & 0x07)])
+        mega_clear_row(addr);
+    }
+  used[0] = 0;
+  used[1] = 0;
+  used[2] = 0;
+}
+
+/*
+  Merge one tile line's worth of a sprite row into the tile line at
+  addr: the pixels in mega_mask take the colors in bitplanes mega_p.
+  A pixel of the collision color under the mask is a collision.
+*/
+static
+void
+mega_line(unsigned int addr)
+{
+  static unsigned int  lo;
+  static unsigned int  hi;
+  static unsigned char hit;
+
+  vreg(0x01);
+  *videoram = addr;
+  vreg(0x02);
+  lo = *videoram;
+  vreg(0x01);
+  *videoram = (addr + 8);
+  vreg(0x02);
+  hi = *videoram;
+
+  if(mega_coll_hw)
+    {
+      hit  = mega_mask;
+      hit &= ((mega_coll_hw & 0x01) ? lo        : ~lo);
+      hit &= ((mega_coll_hw & 0x02) ? (lo >> 8) : ~(lo >> 8));
+      hit &= ((mega_coll_hw & 0x04) ? hi        : ~hi);
+      hit &= ((mega_coll_hw & 0x08) ? (hi >> 8) : ~(hi >> 8));
+      collision |= hit;
+    }
+
+  lo = ((lo & ~((mega_mask << 8) | mega_mask)) | (mega_p[1] << 8) | mega_p[0]);
+  hi = ((hi & ~((mega_mask << 8) | mega_mask)) | (mega_p[3] << 8) | mega_p[2]);
+
+  vreg(0x00);
+  *videoram = addr;
+  vreg(0x02);
+  *videoram = lo;
+  vreg(0x00);
+  *videoram = (addr + 8);
+  vreg(0x02);
+  *videoram = hi;
+}
+
+/*
+  DXYN in the MegaChip mode. Sprites are clipped at the edges.
+*/
+char
+chip8_put_mega(unsigned char *sprite,
+               unsigned char  x,
+               unsigned char  y)
+{
+  static unsigned int  r;
+  static unsigned int  c;
+  static unsigned int  px;
+  static unsigned int  line;
+  static unsigned int  base;
+  static unsigned char idx;
+  static unsigned char hw;
+  static unsigned char bit;
+  static unsigned char ty;
+
+  collision    = 0;
+  mega_coll_hw = (mega_coll ? mega_hw[mega_coll] : 0);
+
+  for(r = 0; r < mega_height; r++, sprite += mega_width)
+    {
+      line = (y + r);
+      if(line >= (MEGA_ROWS << 3))
+        break;
+
+      ty = (line >> 3);
+      mega_used[((mega_back * 3) + (ty >> 3))] |= sprite_bit[(ty & 0x07)];
+      base = (MEGA_ADDR + (ty << 10) + (line & 0x07) +
+              (mega_back ? MEGA_PAGE : 0));
+
+      c  = 0;
+      px = x;
+      while((c < mega_width) && (px < 256))
+        {
+          mega_mask = 0;
+          memset(mega_p,0,sizeof(mega_p));
+          do
+            {
+              idx = sprite[c];
+              if(idx)
+                {
+                  hw  = mega_color(idx);
+                  bit = sprite_bit[(px & 0x07)];
+                  mega_mask |= bit;
+                  if(hw & 0x01)
+                    mega_p[0] |= bit;
+                  if(hw & 0x02)
+                    mega_p[1] |= bit;
+                  if(hw & 0x04)
+                    mega_p[2] |= bit;
+                  if(hw & 0x08)
+                    mega_p[3] |= bit;
+                }
+              c++;
+              px++;
+            }
+          while((c < mega_width) && (px < 256) && (px & 0x07));
+
+          if(mega_mask)
+            mega_line(base + (((px - 1) >> 3) << 4));
+        }
+    }
+
+  return !!collision;
+}
+
+/*
+  mega_clear_row(addr)
+
+  Zero the 32 tiles of a page's tile row from addr, 512 words in a
+  row.
+*/
+#asm
+.code
+_mega_clear_row.1:
+        pha
+        lda  #$00
+        sta  <vdc_reg
+        st0  #$00
+        stx  video_data_l
+        pla
+        sta  video_data_h
+        lda  #$02
+        sta  <vdc_reg
+        st0  #$02
+        st1  #$00
+        ldy  #64
+.run:
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        dey
+        bne  .run
+        rts
+#endasm
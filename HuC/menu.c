@@ -23,10 +23,18 @@
 */
 
 #include "fmemcpy.c"
+
+/* rom_types in roms.c */
+#define ROM_CHIP8  0
+#define ROM_CHIP8X 1
+
 #include "roms.c"
 
 #define PER_PAGE 26
 
+extern unsigned int  ipf;
+extern unsigned char display_mode;
+
 int
 menu(void)
 {
@@ -58,6 +66,10 @@ menu(void)
       put_number(page+1, 1, 6, 0);
       put_char('/', 7, 0);
       put_number(pages, 1, 8, 0);
+      put_string("IPF:", 12, 0);
+      put_number(ipf, 3, 16, 0);
+      put_string("GFX:", 21, 0);
+      put_string(chip8_display_name(), 25, 0);
       for(y = 1; y <= PER_PAGE && i < num_of_roms; y++)
         {
           put_char(idx == i ? '>' : ' ', x-1, y);
@@ -73,17 +85,25 @@ menu(void)
       if(joypad & JOY_I)
         return idx;
 
-      if((joypad & 0xF0) == (prevjoypad & 0xF0))
+      if((joypad & 0xFC) == (prevjoypad & 0xFC))
         continue;
 
       if((joypad & JOY_UP))
         idx -= (joypad & JOY_II) ? 5 : 1;
       else if((joypad & JOY_DOWN))
         idx += (joypad & JOY_II) ? 5 : 1;
+      else if((joypad & JOY_LEFT) && (joypad & JOY_II))
+        chip8_set_display(display_mode - 1);
+      else if((joypad & JOY_RIGHT) && (joypad & JOY_II))
+        chip8_set_display(display_mode + 1);
       else if(joypad & JOY_LEFT)
         idx -= PER_PAGE;
       else if(joypad & JOY_RIGHT)
         idx += PER_PAGE;
+      else if(joypad & JOY_RUN)
+        chip8_set_ipf(ipf + ((joypad & JOY_II) ? 10 : 1));
+      else if(joypad & JOY_SEL)
+        chip8_set_ipf(ipf - ((joypad & JOY_II) ? 10 : 1));
 
       if(idx < 0)
         idx = 0;
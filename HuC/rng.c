@@ -0,0 +1,87 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2014 Antonio SJ Musumeci <trapexit@spawn.link>
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+/*
+  Random numbers
+
+  CXNN used HuC's rand() which walks a pointer through the system
+  card and does a 16 bit add and rotate per call. rng_and() is a 16
+  bit xorshift (7, 9, 8) done in a dozen instructions: every nonzero
+  seed cycles through all 65535 states and the high byte is returned
+  ANDed with NN.
+
+  The seed is set when a ROM starts:
+
+  - rng_fixed == 0: mixed with the system clock, so how long was
+    spent in the menu picks a different sequence every run.
+  - rng_fixed != 0: RNG_SEED every time. The same ROM fed the same
+    input then draws the same numbers, which is what benchmark and
+    regression runs need. `make replay` and `make bench` builds start
+    in this mode.
+*/
+
+#define RNG_SEED 0xACE1
+
+unsigned int  rng_seed;
+unsigned char rng_fixed;
+
+void
+rng_init(void)
+{
+  if(rng_fixed)
+    rng_seed = RNG_SEED;
+  else
+    rng_seed ^= ((clock_ss() << 8) | clock_tt());
+
+  if(rng_seed == 0)
+    rng_seed = RNG_SEED;
+}
+
+/*
+  rng_and(mask)
+
+  Steps the generator and returns its high byte AND mask.
+*/
+#pragma fastcall rng_and(byte acc)
+
+#asm
+.code
+_rng_and.1:
+        stx  <__temp
+        lda  _rng_seed+1
+        lsr  A
+        lda  _rng_seed
+        ror  A
+        eor  _rng_seed+1
+        sta  _rng_seed+1
+        ror  A
+        eor  _rng_seed
+        sta  _rng_seed
+        eor  _rng_seed+1
+        sta  _rng_seed+1
+        and  <__temp
+        tax
+        cla
+        rts
+#endasm
@@ -206,6 +206,78 @@
 #define r5605ca30fdb603ff5096a38e0ec75833_SIZE 144
 #incbin(rd0bf48f2ccaa82c32426e7ab8037c792,"roms/chip8/ZeroPong [zeroZshadow, 2007].ch8");
 #define rd0bf48f2ccaa82c32426e7ab8037c792_SIZE 184
+#incbin(r9f1197a0bbf6026fc4526079b37725bb,"roms/schip/Alien [Jonas Lindstedt, 1993].ch8");
+#define r9f1197a0bbf6026fc4526079b37725bb_SIZE 806
+#incbin(r95934e80031e6d027700bf7022169312,"roms/schip/Ant - In Search of Coke [Erin S. Catto].ch8");
+#define r95934e80031e6d027700bf7022169312_SIZE 3196
+#incbin(r080dc67c4202725e05c5204c74e1213e,"roms/schip/Blinky [Hans Christian Egeberg, 1991].ch8");
+#define r080dc67c4202725e05c5204c74e1213e_SIZE 2528
+#incbin(r82e107c36c5150f1a24a6d7264cc631f,"roms/schip/Car [Klaus von Sengbusch, 1994].ch8");
+#define r82e107c36c5150f1a24a6d7264cc631f_SIZE 320
+#incbin(rf07cd09f69c6da71324d330848c29a92,"roms/schip/Field! [Al Roland, 1993] (alt).ch8");
+#define rf07cd09f69c6da71324d330848c29a92_SIZE 736
+#incbin(ra519beea791acca93c905914528174b2,"roms/schip/Field! [Al Roland, 1993].ch8");
+#define ra519beea791acca93c905914528174b2_SIZE 860
+#incbin(r8b43722e08551dd327ad236c54b690fb,"roms/schip/H. Piper [Paul Raines, 1991].ch8");
+#define r8b43722e08551dd327ad236c54b690fb_SIZE 1828
+#incbin(r87fa21746e95d6087b825b6bdf94a9a4,"roms/schip/Joust [Erin S. Catto, 1993].ch8");
+#define r87fa21746e95d6087b825b6bdf94a9a4_SIZE 2374
+#incbin(r7129855e51ff4fe92d51fb969f0e06e6,"roms/schip/Laser.ch8");
+#define r7129855e51ff4fe92d51fb969f0e06e6_SIZE 366
+#incbin(r7cf08ff16d9d0e12060e701d7d313f00,"roms/schip/Loopz (with difficulty select) [Hap, 2006].ch8");
+#define r7cf08ff16d9d0e12060e701d7d313f00_SIZE 3584
+#incbin(rb02f398a7bfb3a3024f5098f1acfbd1b,"roms/schip/Loopz [Andreas Daumann].ch8");
+#define rb02f398a7bfb3a3024f5098f1acfbd1b_SIZE 3486
+#incbin(r9f7001bbb395401d6b4d8c2f6618046e,"roms/schip/Magic Square [David Winter, 1997].ch8");
+#define r9f7001bbb395401d6b4d8c2f6618046e_SIZE 637
+#incbin(r109bb19a7dd1186c086cb85a3f4059d3,"roms/schip/Matches.ch8");
+#define r109bb19a7dd1186c086cb85a3f4059d3_SIZE 686
+#incbin(r09919bb973d2ef4558b2599d6f5890ee,"roms/schip/Mines! - The minehunter [David Winter, 1997].ch8");
+#define r09919bb973d2ef4558b2599d6f5890ee_SIZE 1875
+#incbin(r2e1b88e1f2c9bd9abd9675aad9121dfc,"roms/schip/Single Dragon (Bomber Section) [David Nurser, 1993].ch8");
+#define r2e1b88e1f2c9bd9abd9675aad9121dfc_SIZE 262
+#incbin(r725c98df9c7abd282d51b0a95914a32f,"roms/schip/Single Dragon (Stages 1-2) [David Nurser, 1993].ch8");
+#define r725c98df9c7abd282d51b0a95914a32f_SIZE 2656
+#incbin(r6bee54868d34cff91e9045f81731dc83,"roms/schip/Sokoban [Hap, 2006] (alt).ch8");
+#define r6bee54868d34cff91e9045f81731dc83_SIZE 3584
+#incbin(r3ef726d7b7a4d148ef8d62cff1c84985,"roms/schip/Sokoban [Hap, 2006].ch8");
+#define r3ef726d7b7a4d148ef8d62cff1c84985_SIZE 3583
+#incbin(r6743226bdb64644dea5040b82ecdf2ec,"roms/schip/Spacefight 2091 [Carsten Soerensen, 1992].ch8");
+#define r6743226bdb64644dea5040b82ecdf2ec_SIZE 2839
+#incbin(r63dca0e0d8c9b6e74dc1ff303d49839a,"roms/schip/Super Astro Dodge [Revival Studios, 2008].ch8");
+#define r63dca0e0d8c9b6e74dc1ff303d49839a_SIZE 1513
+#incbin(r58d311daaa137c6aea259bcac0b028a6,"roms/schip/SuperWorm V3 [RB, 1992].ch8");
+#define r58d311daaa137c6aea259bcac0b028a6_SIZE 360
+#incbin(ra90bcb03cac5e6e463c2031febb019a2,"roms/schip/SuperWorm V4 [RB-Revival Studios, 2007].ch8");
+#define ra90bcb03cac5e6e463c2031febb019a2_SIZE 674
+#incbin(rd910ed653540b5df17c797e114fc299e,"roms/schip/U-Boat [Michael Kemper, 1994].ch8");
+#define rd910ed653540b5df17c797e114fc299e_SIZE 2016
+#incbin(r618164f446683802757ede4e1ba2df99,"roms/chip8x/Color Kaleidoscope [Steve Houk, 1978].c8x");
+#define r618164f446683802757ede4e1ba2df99_SIZE 132
+#incbin(rdee4d078c1175e616d2228a55f20f95d,"roms/chip8x/ColourTest.c8x");
+#define rdee4d078c1175e616d2228a55f20f95d_SIZE 50
+#incbin(ra03743a2714d240941c790821b2ff924,"roms/chip8-hires/Astro Dodge Hires [Revival Studios, 2008].ch8");
+#define ra03743a2714d240941c790821b2ff924_SIZE 1531
+#incbin(re7ffd599e06754bbb1c6c20e0e4c6974,"roms/chip8-hires/Hires Maze [David Winter, 199x].ch8");
+#define re7ffd599e06754bbb1c6c20e0e4c6974_SIZE 230
+#incbin(r7acaf78e00b325d82ac56e8832bb36a1,"roms/chip8-hires/Hires Particle Demo [zeroZshadow, 2008].ch8");
+#define r7acaf78e00b325d82ac56e8832bb36a1_SIZE 545
+#incbin(r0297f63a716095c9eeee072c272353b8,"roms/chip8-hires/Hires Sierpinski [Sergey Naydenov, 2010].ch8");
+#define r0297f63a716095c9eeee072c272353b8_SIZE 725
+#incbin(rac37bc3601ee1e25a3141feb19eebf12,"roms/chip8-hires/Hires Stars [Sergey Naydenov, 2010].ch8");
+#define rac37bc3601ee1e25a3141feb19eebf12_SIZE 1162
+#incbin(r789c9402e06593f35e2d706cd0fd0a21,"roms/chip8-hires/Hires Test [Tom Swan, 1979].ch8");
+#define r789c9402e06593f35e2d706cd0fd0a21_SIZE 214
+#incbin(rfc3c2b800e1a755ee2e21b1cfa37c19f,"roms/chip8-hires/Hires Worm V4 [RB-Revival Studios, 2007].ch8");
+#define rfc3c2b800e1a755ee2e21b1cfa37c19f_SIZE 881
+#incbin(rbb382e51b4371667bc69285c2789d5b6,"roms/chip8-hires/Trip8 Hires Demo (2008) [Revival Studios].ch8");
+#define rbb382e51b4371667bc69285c2789d5b6_SIZE 3156
+#incbin(rff2131ea918902e54e4281a80365d874,"roms/megachip/Mega Minimal [Revival Studios, 2007].ch8");
+#define rff2131ea918902e54e4281a80365d874_SIZE 1914
+#incbin(re2db7268f02cf111ee06926d15c4106f,"roms/megachip/MegaMaze [David Winter, 2007].ch8");
+#define re2db7268f02cf111ee06926d15c4106f_SIZE 84
+#incbin(re11568a710197cb12effd444789f9d0b,"roms/megachip/MegaSirpinski [Sergey Naydenov, 2010].ch8");
+#define re11568a710197cb12effd444789f9d0b_SIZE 725
 
 const char *roms[] =
 {
@@ -312,7 +384,187 @@ const char *roms[] =
   "Worm V4 [RB-Revival Studios, 2007]",
   "X-Mirror",
   "Zero Demo [zeroZshadow, 2007]",
-  "ZeroPong [zeroZshadow, 2007]"
+  "ZeroPong [zeroZshadow, 2007]",
+  "Alien [Jonas Lindstedt, 1993] (SCHIP)",
+  "Ant - In Search of Coke [Erin S. Catto] (SCHIP)",
+  "Blinky [Hans Christian Egeberg, 1991] (SCHIP)",
+  "Car [Klaus von Sengbusch, 1994] (SCHIP)",
+  "Field! [Al Roland, 1993] (alt) (SCHIP)",
+  "Field! [Al Roland, 1993] (SCHIP)",
+  "H. Piper [Paul Raines, 1991] (SCHIP)",
+  "Joust [Erin S. Catto, 1993] (SCHIP)",
+  "Laser (SCHIP)",
+  "Loopz (with difficulty select) [Hap, 2006] (SCHIP)",
+  "Loopz [Andreas Daumann] (SCHIP)",
+  "Magic Square [David Winter, 1997] (SCHIP)",
+  "Matches (SCHIP)",
+  "Mines! - The minehunter [David Winter, 1997] (SCHIP)",
+  "Single Dragon (Bomber Section) [David Nurser, 1993] (SCHIP)",
+  "Single Dragon (Stages 1-2) [David Nurser, 1993] (SCHIP)",
+  "Sokoban [Hap, 2006] (alt) (SCHIP)",
+  "Sokoban [Hap, 2006] (SCHIP)",
+  "Spacefight 2091 [Carsten Soerensen, 1992] (SCHIP)",
+  "Super Astro Dodge [Revival Studios, 2008] (SCHIP)",
+  "SuperWorm V3 [RB, 1992] (SCHIP)",
+  "SuperWorm V4 [RB-Revival Studios, 2007] (SCHIP)",
+  "U-Boat [Michael Kemper, 1994] (SCHIP)",
+  "Color Kaleidoscope [Steve Houk, 1978] (CHIP-8X)",
+  "ColourTest (CHIP-8X)",
+  "Astro Dodge Hires [Revival Studios, 2008] (64x64)",
+  "Hires Maze [David Winter, 199x] (64x64)",
+  "Hires Particle Demo [zeroZshadow, 2008] (64x64)",
+  "Hires Sierpinski [Sergey Naydenov, 2010] (64x64)",
+  "Hires Stars [Sergey Naydenov, 2010] (64x64)",
+  "Hires Test [Tom Swan, 1979] (64x64)",
+  "Hires Worm V4 [RB-Revival Studios, 2007] (64x64)",
+  "Trip8 Hires Demo (2008) [Revival Studios] (64x64)",
+  "Mega Minimal [Revival Studios, 2007] (MegaChip)",
+  "MegaMaze [David Winter, 2007] (MegaChip)",
+  "MegaSirpinski [Sergey Naydenov, 2010] (MegaChip)"
+};
+
+const unsigned char rom_types[] =
+{
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8X,
+  ROM_CHIP8X,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8,
+  ROM_CHIP8
 };
 
 void
@@ -632,6 +884,114 @@ chip8_load_rom(char* dest, int rom)
   case 103:
     fmemcpy(dest,rd0bf48f2ccaa82c32426e7ab8037c792,rd0bf48f2ccaa82c32426e7ab8037c792_SIZE);
     break;
+  case 104:
+    fmemcpy(dest,r9f1197a0bbf6026fc4526079b37725bb,r9f1197a0bbf6026fc4526079b37725bb_SIZE);
+    break;
+  case 105:
+    fmemcpy(dest,r95934e80031e6d027700bf7022169312,r95934e80031e6d027700bf7022169312_SIZE);
+    break;
+  case 106:
+    fmemcpy(dest,r080dc67c4202725e05c5204c74e1213e,r080dc67c4202725e05c5204c74e1213e_SIZE);
+    break;
+  case 107:
+    fmemcpy(dest,r82e107c36c5150f1a24a6d7264cc631f,r82e107c36c5150f1a24a6d7264cc631f_SIZE);
+    break;
+  case 108:
+    fmemcpy(dest,rf07cd09f69c6da71324d330848c29a92,rf07cd09f69c6da71324d330848c29a92_SIZE);
+    break;
+  case 109:
+    fmemcpy(dest,ra519beea791acca93c905914528174b2,ra519beea791acca93c905914528174b2_SIZE);
+    break;
+  case 110:
+    fmemcpy(dest,r8b43722e08551dd327ad236c54b690fb,r8b43722e08551dd327ad236c54b690fb_SIZE);
+    break;
+  case 111:
+    fmemcpy(dest,r87fa21746e95d6087b825b6bdf94a9a4,r87fa21746e95d6087b825b6bdf94a9a4_SIZE);
+    break;
+  case 112:
+    fmemcpy(dest,r7129855e51ff4fe92d51fb969f0e06e6,r7129855e51ff4fe92d51fb969f0e06e6_SIZE);
+    break;
+  case 113:
+    fmemcpy(dest,r7cf08ff16d9d0e12060e701d7d313f00,r7cf08ff16d9d0e12060e701d7d313f00_SIZE);
+    break;
+  case 114:
+    fmemcpy(dest,rb02f398a7bfb3a3024f5098f1acfbd1b,rb02f398a7bfb3a3024f5098f1acfbd1b_SIZE);
+    break;
+  case 115:
+    fmemcpy(dest,r9f7001bbb395401d6b4d8c2f6618046e,r9f7001bbb395401d6b4d8c2f6618046e_SIZE);
+    break;
+  case 116:
+    fmemcpy(dest,r109bb19a7dd1186c086cb85a3f4059d3,r109bb19a7dd1186c086cb85a3f4059d3_SIZE);
+    break;
+  case 117:
+    fmemcpy(dest,r09919bb973d2ef4558b2599d6f5890ee,r09919bb973d2ef4558b2599d6f5890ee_SIZE);
+    break;
+  case 118:
+    fmemcpy(dest,r2e1b88e1f2c9bd9abd9675aad9121dfc,r2e1b88e1f2c9bd9abd9675aad9121dfc_SIZE);
+    break;
+  case 119:
+    fmemcpy(dest,r725c98df9c7abd282d51b0a95914a32f,r725c98df9c7abd282d51b0a95914a32f_SIZE);
+    break;
+  case 120:
+    fmemcpy(dest,r6bee54868d34cff91e9045f81731dc83,r6bee54868d34cff91e9045f81731dc83_SIZE);
+    break;
+  case 121:
+    fmemcpy(dest,r3ef726d7b7a4d148ef8d62cff1c84985,r3ef726d7b7a4d148ef8d62cff1c84985_SIZE);
+    break;
+  case 122:
+    fmemcpy(dest,r6743226bdb64644dea5040b82ecdf2ec,r6743226bdb64644dea5040b82ecdf2ec_SIZE);
+    break;
+  case 123:
+    fmemcpy(dest,r63dca0e0d8c9b6e74dc1ff303d49839a,r63dca0e0d8c9b6e74dc1ff303d49839a_SIZE);
+    break;
+  case 124:
+    fmemcpy(dest,r58d311daaa137c6aea259bcac0b028a6,r58d311daaa137c6aea259bcac0b028a6_SIZE);
+    break;
+  case 125:
+    fmemcpy(dest,ra90bcb03cac5e6e463c2031febb019a2,ra90bcb03cac5e6e463c2031febb019a2_SIZE);
+    break;
+  case 126:
+    fmemcpy(dest,rd910ed653540b5df17c797e114fc299e,rd910ed653540b5df17c797e114fc299e_SIZE);
+    break;
+  case 127:
+    fmemcpy(dest,r618164f446683802757ede4e1ba2df99,r618164f446683802757ede4e1ba2df99_SIZE);
+    break;
+  case 128:
+    fmemcpy(dest,rdee4d078c1175e616d2228a55f20f95d,rdee4d078c1175e616d2228a55f20f95d_SIZE);
+    break;
+  case 129:
+    fmemcpy(dest,ra03743a2714d240941c790821b2ff924,ra03743a2714d240941c790821b2ff924_SIZE);
+    break;
+  case 130:
+    fmemcpy(dest,re7ffd599e06754bbb1c6c20e0e4c6974,re7ffd599e06754bbb1c6c20e0e4c6974_SIZE);
+    break;
+  case 131:
+    fmemcpy(dest,r7acaf78e00b325d82ac56e8832bb36a1,r7acaf78e00b325d82ac56e8832bb36a1_SIZE);
+    break;
+  case 132:
+    fmemcpy(dest,r0297f63a716095c9eeee072c272353b8,r0297f63a716095c9eeee072c272353b8_SIZE);
+    break;
+  case 133:
+    fmemcpy(dest,rac37bc3601ee1e25a3141feb19eebf12,rac37bc3601ee1e25a3141feb19eebf12_SIZE);
+    break;
+  case 134:
+    fmemcpy(dest,r789c9402e06593f35e2d706cd0fd0a21,r789c9402e06593f35e2d706cd0fd0a21_SIZE);
+    break;
+  case 135:
+    fmemcpy(dest,rfc3c2b800e1a755ee2e21b1cfa37c19f,rfc3c2b800e1a755ee2e21b1cfa37c19f_SIZE);
+    break;
+  case 136:
+    fmemcpy(dest,rbb382e51b4371667bc69285c2789d5b6,rbb382e51b4371667bc69285c2789d5b6_SIZE);
+    break;
+  case 137:
+    fmemcpy(dest,rff2131ea918902e54e4281a80365d874,rff2131ea918902e54e4281a80365d874_SIZE);
+    break;
+  case 138:
+    fmemcpy(dest,re2db7268f02cf111ee06926d15c4106f,re2db7268f02cf111ee06926d15c4106f_SIZE);
+    break;
+  case 139:
+    fmemcpy(dest,re11568a710197cb12effd444789f9d0b,re11568a710197cb12effd444789f9d0b_SIZE);
+    break;
 
   default:
     break;
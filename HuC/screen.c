@@ -32,6 +32,41 @@ const unsigned int palette[16] =
     0xFFFF,0xFFFF,0xFFFF,0xFFFF
   };
 
+/*
+  Palette 0 for each page of the CHIP-8 display. Bitplanes 0 and 1
+  (page 0) or 2 and 3 (page 1) are XO-CHIP planes 1 and 2 (see
+  sprite.c): plane 1 alone is white, plane 2 orange and both brown.
+*/
+#define XO_BLACK  0x0000
+#define XO_WHITE  0xFFFF
+#define XO_ORANGE 0x00F8
+#define XO_BLEND  0x0060
+
+const unsigned int page_palette[32] =
+  {
+    XO_BLACK,XO_WHITE,XO_ORANGE,XO_BLEND,
+    XO_BLACK,XO_WHITE,XO_ORANGE,XO_BLEND,
+    XO_BLACK,XO_WHITE,XO_ORANGE,XO_BLEND,
+    XO_BLACK,XO_WHITE,XO_ORANGE,XO_BLEND,
+
+    XO_BLACK,XO_BLACK,XO_BLACK,XO_BLACK,
+    XO_WHITE,XO_WHITE,XO_WHITE,XO_WHITE,
+    XO_ORANGE,XO_ORANGE,XO_ORANGE,XO_ORANGE,
+    XO_BLEND,XO_BLEND,XO_BLEND,XO_BLEND
+  };
+
+void
+screen_show_page(char page)
+{
+  ghost_hold = 1;
+  set_bgpal(0, &page_palette[page ? 16 : 0], 1);
+  if(chip8x)
+    chip8x_show_page(page);
+  if(ghost_active())
+    ghost_show_page(page);
+  ghost_hold = 0;
+}
+
 void
 setup_screen(int res)
 {
@@ -40,7 +75,18 @@ setup_screen(int res)
   set_xres(res);
 
   set_bgpal(0, palette, 1);
+  set_bgpal(1, palette, 1);
+  set_font_pal(1);
+
+  screen_clear();
+}
 
+/*
+  Point the BAT back at the tiles in order and clear them.
+*/
+void
+screen_clear(void)
+{
   gfx_init(GFX_BASEADDR);
   gfx_clear(GFX_BASEADDR);
 }
@@ -25,149 +25,870 @@
 static char collision;
 
 static const int  *videoram   = 0x0002;
-static const char *videoram_l = 0x0002;
-static const char *videoram_h = 0x0003;
+#define DISPLAY_TILES   0
+#define DISPLAY_BAT     1
+#define DISPLAY_FADE    2
+#define DISPLAY_MODES   3
+
+#define PAGE_ROWS       28
+#define PAGE_CLEAR_ROWS 2
+
+#include "display.h"
+
+#define GHOST_LEVELS 4
+
+/*
+  Start of each row's first pixel in page 0. Add 8 for page 1.
+*/
 const unsigned int yaddr[] =
   {
-    0x1000, 0x100F, 0x140E, 0x180D, 0x1C0C, 0x200B, 0x240A, 0x2809,
-    0x2C00, 0x2C0F, 0x300E, 0x340D, 0x380C, 0x3C0B, 0x400A, 0x4409,
-    0x4800, 0x480F, 0x4C0E, 0x500D, 0x540C, 0x580B, 0x5C0A, 0x6009,
-    0x6400, 0x640F, 0x680E, 0x6C0D, 0x700C, 0x740B, 0x780A, 0x7C09
+    0x1000, 0x1007, 0x1406, 0x1805, 0x1C04, 0x2003, 0x2402, 0x2801,
+    0x2C00, 0x2C07, 0x3006, 0x3405, 0x3804, 0x3C03, 0x4002, 0x4401,
+    0x4800, 0x4807, 0x4C06, 0x5005, 0x5404, 0x5803, 0x5C02, 0x6001,
+    0x6400, 0x6407, 0x6806, 0x6C05, 0x7004, 0x7403, 0x7802, 0x7C01
   };
 
+const char *display_names[DISPLAY_MODES] =
+  {
+    "Tiles",
+    "BAT  ",
+    "Fade "
+  };
+
+const unsigned char sprite_bit[8] =
+  {
+    0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01
+  };
+
+/*
+  The display, 8 bytes per row with the leftmost pixel in bit 7 of
+  the first byte. This rather than VRAM is what's XORed against and
+  checked for collisions so drawing never reads back through the VDC.
+
+  Drawing doesn't touch VRAM at all. The pixels a sprite flips are
+  ORed into dirty, laid out the same as shadow, and the first time a
+  byte of it goes non-zero its index is queued. chip8_flush_display()
+  writes the queued pixels out once per frame from the pacing loop,
+  straight after vsync, with whatever value shadow has by then. A
+  pixel drawn over any number of times in a frame is written once
+  and, as every index is queued at most once, the queue can't fill.
+
+  The display is double buffered. Each tile holds two pages: words
+  0 - 7 (bitplanes 0 and 1) and words 8 - 15 (bitplanes 2 and 3).
+  Palette 0 shows one or the other (see screen.c). CLS only empties
+  shadow and sets page_flip, so the next flush draws into the hidden
+  page and then shows it. The page that was hidden is cleared a few
+  tile rows per flush after that and, should another CLS come before
+  it is done, the rest is cleared then.
+
+  Only what was drawn gets cleared. used_rows (a bit per row, laid out
+  like a column of shadow) and used_cols (a bit per byte of a shadow
+  row) collect where sprites have been drawn since the last CLS. CLS
+  moves them to clear_rows / clear_cols, and on the flip those become
+  the area of the newly hidden page that page_clear_next() clears:
+  tile rows which hold none of its rows are skipped and in the rest
+  only the 8 tile wide column groups in its columns are cleared. The
+  BAT renderer's CLS is limited the same way.
+
+  XO-CHIP's second plane (FN01) is kept in shadow2 and drawn in the
+  other bitplane of the page: CHIP-8 plane 1 is bitplane 0 (2 in page
+  1) and plane 2 bitplane 1 (3), the low and high byte of each word.
+  A pixel is then still one word and the page palettes (see screen.c)
+  give the 4 colours. planes is what FN01 selected and planes_used
+  whether plane 2 has been, which until it has leaves everything as
+  it was without it. The BAT renderer only shows plane 1.
+
+  dirty holds the bits of each shadow byte that changed since the
+  last flush and dirty_rows has a bit per row, laid out like
+  used_rows, for the rows with any. The hires display (see hires.c)
+  keeps no shadow and the VIP 64x64 one (tall, see tall.c) needs 512
+  bytes and no dirty bits, so they share display_buf with the lowres
+  shadow, dirty and shadow2. MegaChip (see mega.c) keeps no copy of
+  the display and uses it for its color map.
+
+  DISPLAY_FADE is the tile renderer with erased pixels left to fade
+  out through the palette (see ghost.c). It marks them in ghost_bits,
+  the shadow2 it has no other use for.
+*/
+unsigned char display_buf[SHADOW_SIZE * 3];
+#define shadow      display_buf
+#define dirty       (&display_buf[SHADOW_SIZE])
+#define shadow2     (&display_buf[SHADOW_SIZE * 2])
+#define ghost_bits  shadow2
+unsigned char dirty_rows[4];
+unsigned char page_front;
+unsigned char page_cleared;
+unsigned char page_rows;
+unsigned char page_flip;
+unsigned char used_rows[4];
+unsigned char used_cols;
+unsigned char clear_rows[4];
+unsigned char clear_cols;
+unsigned char page_clear_rows[4];
+unsigned char page_clear_cols;
+unsigned char display_mode;
+unsigned char hires;
+unsigned char tall;
+unsigned char mega;
+unsigned char planes;
+unsigned char planes_used;
+unsigned char plane;
+unsigned char ghost_rows[4];
+unsigned char ghost_level;
+unsigned char ghost_hold;
+unsigned char ghost_page;
+unsigned char ghost_new;
+
+/*
+  The assembly routines at the end of the file. HuC only passes
+  arguments in registers to calls after a function's fastcall
+  pragma.
+*/
+#pragma fastcall setpixel(word di, word acc)
+#pragma fastcall page_clear_row(word acc)
+#pragma fastcall page_clear_groups(word di, byte acc)
+
 char
 chip8_put_sprite(char *sprite,
                  char  x,
                  char  y,
                  char  s)
 {
-  static char i;
-  static char pixels;
-  static int  baseaddr;
+  static char           i;
+  static char           shift;
+  static unsigned char  pixels;
+  static unsigned char  bits;
+  static unsigned char  left;
+  static unsigned char  right;
 
   collision = 0;
+  x     = (x & 0x3F);
+  shift = (x & 0x07);
   for(i = 0; i < s; i++)
     {
-      pixels   = *sprite++;
-      baseaddr = yaddr[(y++ & 0x1F)];
+      pixels = *sprite++;
+      left   = ((y & 0x1F) << 3);
+      right  = (left | (((x >> 3) + 1) & 0x07));
+      left   = (left | (x >> 3));
+      if(pixels == 0)
+        {
+          y++;
+          continue;
+        }
+
+      used_rows[((y >> 3) & 0x03)]  |= sprite_bit[(y & 0x07)];
+      dirty_rows[((y >> 3) & 0x03)] |= sprite_bit[(y & 0x07)];
+      used_cols |= sprite_bit[(left & 0x07)];
+      y++;
+
+      bits = (pixels >> shift);
+      collision |= (shadow[left] & bits);
+      shadow[left] ^= bits;
+      dirty[left] |= bits;
+
+      bits = (pixels << (8 - shift));
+      if(bits == 0)
+        continue;
+      used_cols |= sprite_bit[(right & 0x07)];
+      collision |= (shadow[right] & bits);
+      shadow[right] ^= bits;
+      dirty[right] |= bits;
+    }
+
+  return !!collision;
+}
+
+/*
+  XOR bits into byte idx of shadow2 as chip8_put_sprite() does for
+  shadow.
+*/
+static
+void
+plane2_xor(unsigned char idx,
+           unsigned char bits)
+{
+  if(bits == 0)
+    return;
+
+  used_cols |= sprite_bit[(idx & 0x07)];
+  collision |= (shadow2[idx] & bits);
+  shadow2[idx] ^= bits;
+  dirty[idx] |= bits;
+  dirty_rows[(idx >> 6)] |= sprite_bit[((idx >> 3) & 0x07)];
+}
+
+/*
+  chip8_put_sprite() for plane 2.
+*/
+static
+char
+put_sprite_plane2(unsigned char *sprite,
+                  char           x,
+                  char           y,
+                  char           s)
+{
+  static char           i;
+  static char           shift;
+  static unsigned char  pixels;
+  static unsigned char  row;
+
+  collision = 0;
+  x     = (x & 0x3F);
+  shift = (x & 0x07);
+  for(i = 0; i < s; i++, y++)
+    {
+      pixels = *sprite++;
+      if(pixels == 0)
+        continue;
+
+      used_rows[((y >> 3) & 0x03)] |= sprite_bit[(y & 0x07)];
+      row = ((y & 0x1F) << 3);
+      plane2_xor((row | (x >> 3)),(pixels >> shift));
+      plane2_xor((row | (((x >> 3) + 1) & 0x07)),(pixels << (8 - shift)));
+    }
+
+  return !!collision;
+}
+
+/*
+  DXYN in either resolution. In lowres DXY0 is 8x16 as in SCHIP.
+
+  With both XO-CHIP planes selected the sprite for plane 2 follows
+  the one for plane 1. Hires only draws plane 1.
+*/
+char
+chip8_draw(unsigned char *sprite,
+           char           x,
+           char           y,
+           char           s)
+{
+  static char hit;
+
+  if(mega)
+    return chip8_put_mega(sprite,x,y);
+  if(tall)
+    return chip8_put_tall(sprite,x,y,s);
+  if(hires)
+    return ((planes & 0x01) ? chip8_put_hires(sprite,x,y,s) : 0);
+
+  if(s == 0)
+    s = 16;
+  if(planes == 0x01)
+    return chip8_put_sprite(sprite,x,y,s);
+
+  hit = 0;
+  if(planes & 0x01)
+    {
+      hit     = chip8_put_sprite(sprite,x,y,s);
+      sprite += s;
+    }
+  if(planes & 0x02)
+    hit |= put_sprite_plane2(sprite,x,y,s);
+
+  return hit;
+}
+
+/*
+  FN01. Select the planes drawn to, cleared and scrolled.
+*/
+void
+chip8_set_planes(char mask)
+{
+  planes = (mask & 0x03);
+  if((planes & 0x02) && !(planes_used & 0x02))
+    {
+      planes_used |= 0x02;
+      if(!hires)
+        {
+          ghost_stop();
+          memset(shadow2,0,SHADOW_SIZE);
+        }
+    }
+}
+
+void
+chip8_flush_display(void)
+{
+  static unsigned int   n;
+  static unsigned char  row;
+  static unsigned char  col;
+  static unsigned char  idx;
+  static unsigned char  bits;
+  static unsigned char  page;
+  static char           j;
+  static int            baseaddr;
+  static unsigned int   val;
+  static char           fade;
+
+  fade = ghost_active();
+  page = page_front;
+  if(page_flip && (display_mode == DISPLAY_BAT) && !hires && !tall)
+    {
+      page_flip = 0;
+      bat_clear();
+    }
+  else if(page_flip)
+    {
+      while(page_cleared < page_rows)
+        page_clear_next();
+      page ^= 0x08;
+      ghost_reset();
+    }
+  else if(fade && !ghost_level)
+    {
+      ghost_retire();
+    }
+
+  for(row = 0; row < 32; row++)
+    {
+      if(!(dirty_rows[(row >> 3)] & sprite_bit[(row & 0x07)]))
+        continue;
+      for(col = 0; col < 8; col++)
+        {
+          idx  = ((row << 3) | col);
+          bits = dirty[idx];
+          if(bits == 0)
+            continue;
+
+          dirty[idx] = 0;
+          baseaddr   = (yaddr[row] + (col << 7) + page);
+          for(j = 0; bits; j++, bits <<= 1)
+            {
+              if(!(bits & 0x80))
+                continue;
+              if(display_mode == DISPLAY_BAT)
+                {
+                  bat_pixel(((col << 3) + j),row);
+                  continue;
+                }
+
+              val = ((shadow[idx] & sprite_bit[j]) ? 0x00FF : 0x0000);
+              if((planes_used & 0x02) && (shadow2[idx] & sprite_bit[j]))
+                {
+                  val |= 0xFF00;
+                }
+              else if(fade && !val)
+                {
+                  val = 0xFF00;
+                  ghost_add(idx,sprite_bit[j]);
+                }
+              setpixel((baseaddr + (j << 4)),val);
+            }
+        }
+    }
+
+  memset(dirty_rows,0,sizeof(dirty_rows));
+
+  if(page_flip)
+    {
+      page_flip    = 0;
+      page_front   = page;
+      page_cleared = 0;
+      memcpy(page_clear_rows,clear_rows,sizeof(clear_rows));
+      page_clear_cols = clear_cols;
+      memset(clear_rows,0,sizeof(clear_rows));
+      clear_cols = 0;
+      screen_show_page(page);
+    }
+
+  if(ghost_new)
+    {
+      ghost_new = 0;
+      if(!ghost_level)
+        ghost_start(page);
+    }
+
+  for(n = 0; (n < PAGE_CLEAR_ROWS) && (page_cleared < page_rows); n++)
+    page_clear_next();
+}
+
+/*
+  Byte idx of shadow, or shadow2 if plane is set.
+*/
+static
+unsigned char
+plane_get(unsigned char idx)
+{
+  if(plane)
+    return shadow2[idx];
+
+  return shadow[idx];
+}
+
+/*
+  Set byte idx of shadow, or shadow2 if plane is set, to val, queueing
+  whatever changes.
+*/
+static
+void
+plane_set(unsigned char idx,
+          unsigned char val)
+{
+  static unsigned char bits;
+
+  bits = (plane_get(idx) ^ val);
+  if(bits == 0)
+    return;
+
+  if(plane)
+    shadow2[idx] = val;
+  else
+    shadow[idx] = val;
+  dirty[idx] |= bits;
+  dirty_rows[(idx >> 6)] |= sprite_bit[((idx >> 3) & 0x07)];
+}
+
+/*
+  Move the shadow of plane by dx and dy as chip8_scroll() describes.
+*/
+static
+void
+plane_scroll(int dx,
+             int dy)
+{
+  static int           r;
+  static int           c;
+  static int           n;
+  static unsigned char idx;
+
+  n = ((dy > 0 ? dy : -dy) >> 1);
+  if(dy > 0)
+    {
+      for(r = 31; r >= 0; r--)
+        for(c = 0; c < 8; c++)
+          plane_set(((r << 3) | c),((r >= n) ? plane_get(((r - n) << 3) | c) : 0));
+    }
+  else if(dy < 0)
+    {
+      for(r = 0; r < 32; r++)
+        for(c = 0; c < 8; c++)
+          plane_set(((r << 3) | c),((r + n < 32) ? plane_get(((r + n) << 3) | c) : 0));
+    }
 
-      setpixel((baseaddr + (((x+0) & 0x3f) << 4)), (pixels & 0x80));
-      setpixel((baseaddr + (((x+1) & 0x3f) << 4)), (pixels & 0x40));
-      setpixel((baseaddr + (((x+2) & 0x3f) << 4)), (pixels & 0x20));
-      setpixel((baseaddr + (((x+3) & 0x3f) << 4)), (pixels & 0x10));
-      setpixel((baseaddr + (((x+4) & 0x3f) << 4)), (pixels & 0x08));
-      setpixel((baseaddr + (((x+5) & 0x3f) << 4)), (pixels & 0x04));
-      setpixel((baseaddr + (((x+6) & 0x3f) << 4)), (pixels & 0x02));
-      setpixel((baseaddr + (((x+7) & 0x3f) << 4)), (pixels & 0x01));
+  if(dx > 0)
+    {
+      for(r = 0; r < 32; r++)
+        for(idx = (r << 3), c = 7; c >= 0; c--)
+          plane_set((idx | c),((plane_get(idx | c) >> 2) | (c ? (plane_get(idx | (c - 1)) << 6) : 0)));
+    }
+  else if(dx < 0)
+    {
+      for(r = 0; r < 32; r++)
+        for(idx = (r << 3), c = 0; c < 8; c++)
+          plane_set((idx | c),((plane_get(idx | c) << 2) | ((c < 7) ? (plane_get(idx | (c + 1)) >> 6) : 0)));
     }
+}
 
-  return collision;
+/*
+  00BN / 00CN / 00FB / 00FC: scroll by dx pixels (4 or -4) and dy
+  rows (down if positive) of hires. See hires.c for hires, where the
+  hardware scroll moves every plane. In lowres that's half as many
+  pixels, with SCHIP's half rows rounded down, and the shadow of each
+  selected plane is moved a byte at a time with the pixels that change
+  queued for the next flush as for a sprite. The VIP's 64x64
+  interpreter has no scrolling.
+*/
+void
+chip8_scroll(int dx,
+             int dy)
+{
+  if(tall || mega)
+    return;
+  if(hires)
+    {
+      hires_scroll(dx,dy);
+      return;
+    }
+
+  if(planes & 0x01)
+    {
+      plane = 0;
+      plane_scroll(dx,dy);
+    }
+  if((planes & 0x02) && (planes_used & 0x02))
+    {
+      plane = 1;
+      plane_scroll(dx,dy);
+      plane = 0;
+    }
+
+  memset(used_rows,0xFF,sizeof(used_rows));
+  used_cols = 0xFF;
+}
+
+void
+chip8_clear_shadow(void)
+{
+  if(tall)
+    {
+      memset(shadow,0,TALL_SHADOW_SIZE);
+    }
+  else if(!hires)
+    {
+      memset(shadow,0,SHADOW_SIZE);
+      memset(dirty,0,SHADOW_SIZE);
+      if(planes_used & 0x02)
+        memset(shadow2,0,SHADOW_SIZE);
+    }
+  memset(dirty_rows,0,sizeof(dirty_rows));
 }
 
+/*
+  Clear only the selected plane, drawing the change as for a sprite.
+*/
 static
 void
-setpixel(const int addr,
-         char      val)
+plane_cls(void)
 {
-  static char pixel;
+  static int idx;
+
+  plane = (planes == 0x02);
+  for(idx = 0; idx < SHADOW_SIZE; idx++)
+    plane_set(idx,0);
+  plane = 0;
+}
 
+/*
+  CLS. See page_flip above. Once XO-CHIP plane 2 is in use clearing
+  just one of the planes can't flip to a blank page.
+*/
+void
+chip8_cls(void)
+{
+  if(mega)
+    {
+      mega_cls();
+      return;
+    }
+  if(tall)
+    {
+      chip8_clear_shadow();
+      hires_cls();
+      return;
+    }
+  if(hires && !(planes & 0x01))
+    return;
+  if(!hires && (planes_used & 0x02) && (planes != 0x03))
+    {
+      if(planes)
+        plane_cls();
+      return;
+    }
+
+  chip8_clear_shadow();
+  if(hires)
+    {
+      hires_cls();
+      return;
+    }
+
+  page_flip      = 1;
+  clear_rows[0] |= used_rows[0];
+  clear_rows[1] |= used_rows[1];
+  clear_rows[2] |= used_rows[2];
+  clear_rows[3] |= used_rows[3];
+  clear_cols    |= used_cols;
+  memset(used_rows,0,sizeof(used_rows));
+  used_cols      = 0;
+}
+
+/*
+  Called once the screen has been set up (and cleared) for a ROM, and
+  by chip8_set_hires() when it clears it.
+*/
+void
+chip8_display_init(void)
+{
+  chip8_clear_shadow();
+  ghost_reset();
+  page_front   = 0;
+  page_flip    = 0;
+  memset(used_rows,0,sizeof(used_rows));
+  memset(clear_rows,0,sizeof(clear_rows));
+  memset(page_clear_rows,0,sizeof(page_clear_rows));
+  used_cols       = 0;
+  clear_cols      = 0;
+  page_clear_cols = 0;
+  screen_show_page(0);
+  hires_scroll_reset();
+
+  if((display_mode == DISPLAY_BAT) && !hires && !tall)
+    {
+      page_rows = 0;
+      bat_init();
+    }
+  else
+    {
+      page_rows = PAGE_ROWS;
+    }
+
+  page_cleared = page_rows;
+}
+
+void
+chip8_display_stop(void)
+{
+  hires_scroll_reset();
+}
+
+void
+chip8_set_display(int mode)
+{
+  if(mode < 0)
+    mode = (DISPLAY_MODES - 1);
+  else if(mode >= DISPLAY_MODES)
+    mode = 0;
+
+  display_mode = mode;
+}
+
+char*
+chip8_display_name(void)
+{
+  return display_names[display_mode];
+}
+
+/*
+  Whether tile row ty of the current renderer shows any of rows.
+*/
+static
+char
+page_row_used(unsigned char *rows,
+              char           ty)
+{
+  if(hires || tall)
+    return hires_row_used(rows,ty);
+
+  return bat_row_used(rows,ty);
+}
+
+/*
+  Clear the next tile row of the hidden page with anything in it.
+*/
+static
+void
+page_clear_next(void)
+{
+  static int addr;
+
+  while((page_cleared < page_rows) &&
+        !page_row_used(page_clear_rows,page_cleared))
+    page_cleared++;
+  if(page_cleared == page_rows)
+    return;
+
+  addr = (0x1000 + (page_cleared << 10) + (page_front ^ 0x08));
+  if(page_clear_cols == 0xFF)
+    page_clear_row(addr);
+  else
+    page_clear_groups(addr,page_clear_cols);
+  page_cleared++;
+}
+
+/*
+  page_clear_row(addr)
+
+  Zero words addr to addr + 7 of each of the 64 tiles in the row.
+  Tiles are 16 words apart, which isn't one of the VDC's address
+  increments, so the increment is set to 32 and each of the 8 words
+  is cleared in the even tiles and then the odd ones: 16 runs of 32
+  writes rather than setting the address for each tile.
+*/
+#asm
+.code
+_page_clear_row.1:
+        stx  <__temp
+        sta  <__temp+1
+        lda  #$05
+        sta  <vdc_reg
+        st0  #$05
+        st2  #$08
+        ldy  #16
+.run:
+        lda  #$00
+        sta  <vdc_reg
+        st0  #$00
+        lda  <__temp
+        sta  video_data_l
+        lda  <__temp+1
+        sta  video_data_h
+        lda  #$02
+        sta  <vdc_reg
+        st0  #$02
+        st1  #$00
+        ldx  #4
+.words:
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        dex
+        bne  .words
+        inc  <__temp
+        dey
+        cpy  #8
+        bne  .next
+        lda  <__temp
+        clc
+        adc  #$08
+        sta  <__temp
+.next:
+        cpy  #0
+        bne  .run
+        lda  #$05
+        sta  <vdc_reg
+        st0  #$05
+        st2  #$00
+        rts
+#endasm
+
+/*
+  page_clear_groups(addr, mask)
+
+  page_clear_row() for only the groups of 8 tiles set in mask, bit 7
+  being tiles 0 - 7. Each group is 16 runs of 4 writes.
+*/
+#asm
+.code
+_page_clear_groups.2:
+        stx  <__temp+2
+        lda  #$05
+        sta  <vdc_reg
+        st0  #$05
+        st2  #$08
+.group:
+        asl  <__temp+2
+        bcc  .skip
+        lda  <_di
+        sta  <__temp
+        lda  <_di+1
+        sta  <__temp+1
+        ldy  #16
+.run:
+        lda  #$00
+        sta  <vdc_reg
+        st0  #$00
+        lda  <__temp
+        sta  video_data_l
+        lda  <__temp+1
+        sta  video_data_h
+        lda  #$02
+        sta  <vdc_reg
+        st0  #$02
+        st1  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        st2  #$00
+        inc  <__temp
+        dey
+        cpy  #8
+        bne  .next
+        lda  <__temp
+        clc
+        adc  #$08
+        sta  <__temp
+.next:
+        cpy  #0
+        bne  .run
+.skip:
+        addw #128,<_di
+        lda  <__temp+2
+        bne  .group
+        lda  #$05
+        sta  <vdc_reg
+        st0  #$05
+        st2  #$00
+        rts
+#endasm
+
+static
+void
+setword(const int addr,
+        const int val)
+{
   vreg(0x00);
   *videoram = addr;
-  vreg(0x01);
-  *videoram = addr;
   vreg(0x02);
-
-  val   = !!val;
-  pixel = !!*videoram_l;
-
-  collision |= val & pixel;
-  pixel      = val ^ pixel ? 0xFF : 0x00;
-
-  *videoram_l = pixel;
-  switch(addr & 0x07)
-    {
-    default:
-    case 0:
-    case 1:
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      break;
-
-    case 2:
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      vreg(0x00,addr+1022);
-      vreg(0x02);
-      *videoram_h = 0x00;
-      break;
-
-    case 3:
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      vreg(0x00,addr+1021);
-      vreg(0x02);
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      break;
-
-    case 4:
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      vreg(0x00,addr+1020);
-      vreg(0x02);
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      break;
-
-    case 5:
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      vreg(0x00,addr+1019);
-      vreg(0x02);
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      break;
-
-    case 6:
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      vreg(0x00,addr+1018);
-      vreg(0x02);
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      break;
-
-    case 7:
-      *videoram_h = 0x00;
-      vreg(0x00,addr+1017);
-      vreg(0x02);
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      break;
-    }
+  *videoram = val;
 }
+
+/*
+  setpixel(addr, val)
+
+  Draw one pixel of the tile renderer: 7 lines, from addr on, of the
+  word val (0x00FF for CHIP-8 plane 1, 0xFF00 for XO-CHIP plane 2).
+  The low byte goes into the VDC's write latch once so each line is a
+  single high byte store, and the address is only set again if the
+  pixel carries on into the next tile row.
+*/
+#asm
+.code
+_setpixel.2:
+        sta  <__temp
+        lda  #$00
+        sta  <vdc_reg
+        st0  #$00
+        lda  <_di
+        sta  video_data_l
+        lda  <_di+1
+        sta  video_data_h
+        lda  #$02
+        sta  <vdc_reg
+        st0  #$02
+        stx  video_data_l
+
+        lda  <_di
+        and  #$07
+        cmp  #$02
+        bcs  .split
+        lda  <__temp
+        sta  video_data_h
+        sta  video_data_h
+        sta  video_data_h
+        sta  video_data_h
+        sta  video_data_h
+        sta  video_data_h
+        sta  video_data_h
+        rts
+
+.split:
+        eor  #$07
+        inc  A
+        tay
+        lda  <__temp
+.top:
+        sta  video_data_h
+        dey
+        bne  .top
+
+        lda  #$00
+        sta  <vdc_reg
+        st0  #$00
+        lda  <_di
+        and  #$F8
+        sta  video_data_l
+        lda  <_di+1
+        clc
+        adc  #$04
+        sta  video_data_h
+        lda  #$02
+        sta  <vdc_reg
+        st0  #$02
+        stx  video_data_l
+
+        lda  <_di
+        and  #$07
+        dec  A
+        tay
+        lda  <__temp
+.bottom:
+        sta  video_data_h
+        dey
+        bne  .bottom
+        rts
+#endasm
@@ -0,0 +1,215 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2014 Antonio SJ Musumeci <trapexit@spawn.link>
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+/*
+  VIP 64x64 hires
+
+  ROMs for the VIP's 64x64 hires interpreter carry it in front of the
+  program: a stub at 0x200, starting with 1260, which sets up the
+  display and runs the program from 0x2C0. chip8_check_boot() spots
+  it once the ROM is loaded and starts at 0x2C0 with tall set instead.
+  0230 is that interpreter's CLS.
+
+  Pixels are a tile wide as in lowres but 3.5 lines tall to fit 64
+  rows in 224 lines: even rows are 4 lines and odd rows 3. Row y
+  starts at tall_yaddr[y] in page 0 and pixel x is x tiles on from
+  there, so a pixel is 3 or 4 words down a tile column, carrying on
+  into the tile row below when it starts on one of its last lines.
+
+  shadow is 8 bytes per row, TALL_SHADOW_SIZE (see display.h) in
+  all, leaving no room for dirty bits, so as in SCHIP hires (see
+  hires.c) sprites write VRAM as they are drawn, only the pixels they
+  flip, into the hidden page after a CLS, and CLS is hires_cls().
+  used_rows / used_cols are a bit per tile row and per 8 tile column
+  group. Like SCHIP hires this always uses the tile renderer's layout.
+*/
+
+#define TALL_START 0x2C0
+
+const unsigned int tall_yaddr[64] =
+  {
+    0x1000, 0x1004, 0x1007, 0x1403, 0x1406, 0x1802, 0x1805, 0x1C01,
+    0x1C04, 0x2000, 0x2003, 0x2007, 0x2402, 0x2406, 0x2801, 0x2805,
+    0x2C00, 0x2C04, 0x2C07, 0x3003, 0x3006, 0x3402, 0x3405, 0x3801,
+    0x3804, 0x3C00, 0x3C03, 0x3C07, 0x4002, 0x4006, 0x4401, 0x4405,
+    0x4800, 0x4804, 0x4807, 0x4C03, 0x4C06, 0x5002, 0x5005, 0x5401,
+    0x5404, 0x5800, 0x5803, 0x5807, 0x5C02, 0x5C06, 0x6001, 0x6005,
+    0x6400, 0x6404, 0x6407, 0x6803, 0x6806, 0x6C02, 0x6C05, 0x7001,
+    0x7004, 0x7400, 0x7403, 0x7407, 0x7802, 0x7806, 0x7C01, 0x7C05
+  };
+
+/* Defined at the end of the file. */
+#pragma fastcall tall_pixel(word di, byte al, word acc)
+
+/*
+  XOR bits into shadow byte idx and write the pixels that flipped,
+  lines lines each from addr, the start of the byte's first pixel.
+*/
+static
+void
+tall_byte(unsigned int  idx,
+          unsigned int  addr,
+          unsigned char bits,
+          unsigned char lines)
+{
+  static unsigned char val;
+  static char          j;
+
+  collision |= (shadow[idx] & bits);
+  shadow[idx] ^= bits;
+  used_cols |= sprite_bit[(idx & 0x07)];
+
+  val   = shadow[idx];
+  addr += ((idx & 0x07) << 7);
+  for(j = 0; bits; j++, bits <<= 1)
+    {
+      if(bits & 0x80)
+        tall_pixel((addr + (j << 4)),lines,((val & sprite_bit[j]) ? 0x00FF : 0x0000));
+    }
+}
+
+/*
+  DXYN in 64x64. Sprites wrap around the edges as in lowres.
+*/
+char
+chip8_put_tall(unsigned char *sprite,
+               char           x,
+               char           y,
+               char           s)
+{
+  static char           i;
+  static char           shift;
+  static unsigned char  pixels;
+  static unsigned char  bits;
+  static unsigned char  lines;
+  static unsigned char  ty;
+  static unsigned int   row;
+  static unsigned int   addr;
+  static unsigned int   page;
+
+  page = page_front;
+  if(page_flip)
+    page ^= 0x08;
+
+  collision = 0;
+  x     = (x & 0x3F);
+  shift = (x & 0x07);
+  for(i = 0; i < s; i++, y++)
+    {
+      pixels = *sprite++;
+      if(pixels == 0)
+        continue;
+
+      row   = (y & 0x3F);
+      addr  = (tall_yaddr[row] + page);
+      lines = (4 - (row & 0x01));
+      ty    = ((tall_yaddr[row] >> 10) - 4);
+      used_rows[(ty >> 3)] |= sprite_bit[(ty & 0x07)];
+      if(((addr & 0x07) + lines) > 8)
+        {
+          ty++;
+          used_rows[(ty >> 3)] |= sprite_bit[(ty & 0x07)];
+        }
+
+      row <<= 3;
+      tall_byte((row | (x >> 3)),addr,(pixels >> shift),lines);
+      bits = (pixels << (8 - shift));
+      if(bits != 0)
+        tall_byte((row | (((x >> 3) + 1) & 0x07)),addr,bits,lines);
+    }
+
+  return !!collision;
+}
+
+/*
+  tall_pixel(addr, lines, val)
+
+  setpixel() for 64x64: lines (3 or 4) words of val from addr, the
+  address set again for the rest if it runs past the end of the tile.
+*/
+#asm
+.code
+_tall_pixel.3:
+        sta  <__temp
+        lda  #$00
+        sta  <vdc_reg
+        st0  #$00
+        lda  <_di
+        sta  video_data_l
+        lda  <_di+1
+        sta  video_data_h
+        lda  #$02
+        sta  <vdc_reg
+        st0  #$02
+        stx  video_data_l
+
+        lda  <_di
+        and  #$07
+        eor  #$07
+        inc  A
+        cmp  <_al
+        bcc  .split
+        ldy  <_al
+        lda  <__temp
+.lines:
+        sta  video_data_h
+        dey
+        bne  .lines
+        rts
+
+.split:
+        sta  <__temp+1
+        tay
+        lda  <__temp
+.top:
+        sta  video_data_h
+        dey
+        bne  .top
+
+        lda  #$00
+        sta  <vdc_reg
+        st0  #$00
+        lda  <_di
+        and  #$F8
+        sta  video_data_l
+        lda  <_di+1
+        clc
+        adc  #$04
+        sta  video_data_h
+        lda  #$02
+        sta  <vdc_reg
+        st0  #$02
+        stx  video_data_l
+
+        lda  <_al
+        sec
+        sbc  <__temp+1
+        tay
+        lda  <__temp
+.bottom:
+        sta  video_data_h
+        dey
+        bne  .bottom
+        rts
+#endasm
@@ -32,6 +32,7 @@ main(void)
 {
   int romidx;
 
+  chip8_set_ipf(DEFAULT_IPF);
   while(1)
     {
       chip8_init();
@@ -0,0 +1,479 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2014 Antonio SJ Musumeci <trapexit@spawn.link>
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+/*
+  Assembly interpreter core
+
+  core_run(count) executes up to count opcodes straight out of RAM
+  with V0 - VF, I and PC held in zero page. Dispatch is an indirect
+  jump on the high nibble with second level tables for 5XYN, 8XYN
+  and FXNN. 8XY4, 8XY5 and 8XY7 take VF from the 6280's own carry.
+
+  Only the register / flow control opcodes are handled here. Anything
+  that touches the screen, keypad, RAM or is otherwise uncommon
+  (00E0, CXNN, DXYN, EX9E, FX0A, FX33, FX55, ...) rewinds PC and
+  returns CORE_SLOW so chip8_run can hand that one instruction to the
+  C handlers. The core never writes RAM so the C decode cache of a CD
+  build stays valid.
+
+  Returns SUCCESS once count opcodes have run, IDLE on a jump to self
+  or an FX07 / 3XNN / 1NNN delay timer poll (same rules as idle.c) or
+  CORE_SLOW. The number of opcodes executed is left in core_count.
+
+  The status values below must match emulator.c.
+*/
+
+unsigned int core_count;
+
+#pragma fastcall core_run(word acc)
+
+#asm
+        .zp
+core_v:         .ds 16
+core_pc:        .ds 2
+core_i:         .ds 2
+core_cnt:       .ds 2
+core_ptr:       .ds 2
+core_lo:        .ds 1
+core_x:         .ds 1
+core_y:         .ds 1
+
+        .code
+_core_run.1:
+     __stw  <core_cnt
+     __stw  _core_count
+        tii  _v,core_v,16
+       addw  #_RAM,_PC,<core_pc
+        stw  _I,<core_i
+
+core_loop:
+       tstw  <core_cnt
+       lbeq  core_done
+       decw  <core_cnt
+
+        lda  [core_pc]
+        tax
+        and  #$0F
+        sta  <core_x
+        ldy  #1
+        lda  [core_pc],Y
+        sta  <core_lo
+        lsr  A
+        lsr  A
+        lsr  A
+        lsr  A
+        sta  <core_y
+       addw  #2,<core_pc
+
+        txa
+        and  #$F0
+        lsr  A
+        lsr  A
+        lsr  A
+        tax
+        jmp  [core_ops,X]
+
+core_skip:
+       addw  #2,<core_pc
+        jmp  core_loop
+
+        ;; 00EE - RET
+core_op0:
+        lda  <core_x
+       lbne  core_slow
+        lda  <core_lo
+        cmp  #$EE
+       lbne  core_slow
+        dec  _SP
+        lda  _SP
+        asl  A
+        tax
+        clc
+        lda  _STACK,X
+        adc  #low(_RAM)
+        sta  <core_pc
+        lda  _STACK+1,X
+        adc  #high(_RAM)
+        sta  <core_pc+1
+        jmp  core_loop
+
+        ;; 1NNN - JP addr
+core_op1:
+        clc
+        lda  <core_lo
+        adc  #low(_RAM)
+        sta  <core_ptr
+        lda  <core_x
+        adc  #high(_RAM)
+        sta  <core_ptr+1
+
+        lda  _idle
+        beq  .jump
+       subw  #2,<core_pc
+       cmpw  <core_ptr,<core_pc
+       lbeq  core_idle
+       subw  #4,<core_pc
+       cmpw  <core_ptr,<core_pc
+        bne  .jump
+        lda  [core_ptr]
+        and  #$F0
+        cmp  #$F0
+        bne  .jump
+        ldy  #1
+        lda  [core_ptr],Y
+        cmp  #$07
+        bne  .jump
+        lda  [core_ptr]
+        ldy  #2
+        eor  [core_ptr],Y
+        cmp  #$C0
+        bne  .jump
+        stw  <core_ptr,<core_pc
+        jmp  core_idle
+.jump:
+        stw  <core_ptr,<core_pc
+        jmp  core_loop
+
+        ;; 2NNN - CALL addr
+core_op2:
+        lda  _SP
+        asl  A
+        tax
+        sec
+        lda  <core_pc
+        sbc  #low(_RAM)
+        sta  _STACK,X
+        lda  <core_pc+1
+        sbc  #high(_RAM)
+        sta  _STACK+1,X
+        inc  _SP
+        clc
+        lda  <core_lo
+        adc  #low(_RAM)
+        sta  <core_pc
+        lda  <core_x
+        adc  #high(_RAM)
+        sta  <core_pc+1
+        jmp  core_loop
+
+        ;; 3XNN - SE VX, byte
+core_op3:
+        ldx  <core_x
+        lda  <core_v,X
+        cmp  <core_lo
+       lbeq  core_skip
+        jmp  core_loop
+
+        ;; 4XNN - SNE VX, byte
+core_op4:
+        ldx  <core_x
+        lda  <core_v,X
+        cmp  <core_lo
+       lbne  core_skip
+        jmp  core_loop
+
+        ;; 5XY0 - 5XY3 - SE / SGT / SLT / SNE VX, VY
+core_op5:
+        lda  <core_lo
+        and  #$0F
+        cmp  #$04
+       lbhs  core_slow
+        asl  A
+        tax
+        ldy  <core_y
+        lda  core_v,Y
+        sta  <core_ptr
+        ldy  <core_x
+        lda  core_v,Y
+        cmp  <core_ptr
+        jmp  [core_ops5,X]
+core_5xy0:
+       lbeq  core_skip
+        jmp  core_loop
+core_5xy1:
+        beq  .no
+       lbhs  core_skip
+.no:
+        jmp  core_loop
+core_5xy2:
+       lblo  core_skip
+        jmp  core_loop
+core_5xy3:
+       lbne  core_skip
+        jmp  core_loop
+
+        ;; 6XNN - LD VX, byte
+core_op6:
+        ldx  <core_x
+        lda  <core_lo
+        sta  <core_v,X
+        jmp  core_loop
+
+        ;; 7XNN - ADD VX, byte
+core_op7:
+        ldx  <core_x
+        clc
+        lda  <core_v,X
+        adc  <core_lo
+        sta  <core_v,X
+        jmp  core_loop
+
+        ;; 8XYN - ALU
+core_op8:
+        lda  <core_lo
+        and  #$0F
+        asl  A
+        tax
+        ldy  <core_y
+        lda  <core_x
+        jmp  [core_ops8,X]
+core_8xy0:
+        tax
+        lda  core_v,Y
+        sta  <core_v,X
+        jmp  core_loop
+core_8xy1:
+        tax
+        lda  <core_v,X
+        ora  core_v,Y
+        sta  <core_v,X
+        jmp  core_loop
+core_8xy2:
+        tax
+        lda  <core_v,X
+        and  core_v,Y
+        sta  <core_v,X
+        jmp  core_loop
+core_8xy3:
+        tax
+        lda  <core_v,X
+        eor  core_v,Y
+        sta  <core_v,X
+        jmp  core_loop
+
+        ;; VF is written before VX, as the C handlers do, so the
+        ;; result is the same when X or Y is F.
+core_8xy4:
+        tax
+        clc
+        lda  <core_v,X
+        adc  core_v,Y
+        cla
+        rol  A
+        sta  <core_v+15
+        clc
+        lda  <core_v,X
+        adc  core_v,Y
+        sta  <core_v,X
+        jmp  core_loop
+core_8xy5:
+        tax
+        sec
+        lda  <core_v,X
+        sbc  core_v,Y
+        cla
+        rol  A
+        sta  <core_v+15
+        sec
+        lda  <core_v,X
+        sbc  core_v,Y
+        sta  <core_v,X
+        jmp  core_loop
+core_8xy6:
+        tax
+        lda  <core_v,X
+        and  #$01
+        sta  <core_v+15
+        lsr  <core_v,X
+        jmp  core_loop
+core_8xy7:
+        tax
+        sec
+        lda  core_v,Y
+        sbc  <core_v,X
+        cla
+        rol  A
+        sta  <core_v+15
+        sec
+        lda  core_v,Y
+        sbc  <core_v,X
+        sta  <core_v,X
+        jmp  core_loop
+core_8xye:
+        tax
+        lda  <core_v,X
+        asl  A
+        cla
+        rol  A
+        sta  <core_v+15
+        asl  <core_v,X
+        jmp  core_loop
+
+        ;; 9XY0 - SNE VX, VY
+core_op9:
+        lda  <core_lo
+        and  #$0F
+       lbne  core_slow
+        ldx  <core_x
+        ldy  <core_y
+        lda  <core_v,X
+        cmp  core_v,Y
+       lbne  core_skip
+        jmp  core_loop
+
+        ;; ANNN - LD I, addr
+core_opa:
+        lda  <core_lo
+        sta  <core_i
+        lda  <core_x
+        sta  <core_i+1
+        jmp  core_loop
+
+        ;; BNNN - JP V0, addr
+core_opb:
+        clc
+        lda  <core_lo
+        adc  <core_v
+        sta  <core_ptr
+        lda  <core_x
+        adc  #0
+        sta  <core_ptr+1
+       addw  #_RAM,<core_ptr,<core_pc
+        jmp  core_loop
+
+        ;; FXNN
+core_opf:
+        ldy  <core_lo
+        ldx  core_f_slot,Y
+        jmp  [core_opsf,X]
+core_fx07:
+        ldx  <core_x
+        lda  _delay_timer
+        sta  <core_v,X
+        jmp  core_loop
+core_fx15:
+        ldx  <core_x
+        lda  <core_v,X
+        sta  _delay_timer
+        jmp  core_loop
+core_fx1e:
+        ldx  <core_x
+        clc
+        lda  <core_i
+        adc  <core_v,X
+        sta  <core_i
+        lda  <core_i+1
+        adc  #0
+        tay
+        and  #$0F
+        sta  <core_i+1
+        cla
+        cpy  #$10
+        rol  A
+        sta  <core_v+15
+        jmp  core_loop
+core_fx29:
+        ldx  <core_x
+        lda  <core_v,X
+        and  #$0F
+        sta  <core_ptr
+        asl  A
+        asl  A
+        adc  <core_ptr
+        sta  <core_i
+        stz  <core_i+1
+        jmp  core_loop
+core_fx65:
+       addw  #_RAM,<core_i,<core_ptr
+        ldy  <core_x
+.copy:
+        lda  [core_ptr],Y
+        sta  core_v,Y
+        dey
+        bpl  .copy
+        jmp  core_loop
+
+        ;; Not handled here: back up to the opcode and let C run it
+core_slow:
+       subw  #2,<core_pc
+       incw  <core_cnt
+        ldx  #5                 ; CORE_SLOW
+        bra  core_exit
+core_idle:
+        ldx  #4                 ; IDLE
+        bra  core_exit
+core_done:
+        ldx  #0                 ; SUCCESS
+core_exit:
+        tii  core_v,_v,16
+        sec
+        lda  <core_pc
+        sbc  #low(_RAM)
+        sta  _PC
+        lda  <core_pc+1
+        sbc  #high(_RAM)
+        sta  _PC+1
+        stw  <core_i,_I
+       subw  <core_cnt,_core_count
+        cla
+        rts
+
+core_ops:
+        .dw  core_op0,  core_op1,  core_op2,  core_op3
+        .dw  core_op4,  core_op5,  core_op6,  core_op7
+        .dw  core_op8,  core_op9,  core_opa,  core_opb
+        .dw  core_slow, core_slow, core_slow, core_opf
+
+core_ops5:
+        .dw  core_5xy0, core_5xy1, core_5xy2, core_5xy3
+
+core_ops8:
+        .dw  core_8xy0, core_8xy1, core_8xy2, core_8xy3
+        .dw  core_8xy4, core_8xy5, core_8xy6, core_8xy7
+        .dw  core_slow, core_slow, core_slow, core_slow
+        .dw  core_slow, core_slow, core_8xye, core_slow
+
+core_opsf:
+        .dw  core_slow, core_fx07, core_fx15, core_fx1e
+        .dw  core_fx29, core_fx65
+
+        ;; FXNN low byte -> core_opsf offset
+core_f_slot:
+        .db  0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0    ; 0
+        .db  0,0,0,0,0,4,0,0,0,0,0,0,0,0,6,0    ; 1
+        .db  0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0    ; 2
+        .db  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0    ; 3
+        .db  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0    ; 4
+        .db  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0    ; 5
+        .db  0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0   ; 6
+        .db  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0    ; 7
+        .db  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0    ; 8
+        .db  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0    ; 9
+        .db  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0    ; A
+        .db  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0    ; B
+        .db  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0    ; C
+        .db  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0    ; D
+        .db  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0    ; E
+        .db  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0    ; F
+#endasm
@@ -26,17 +26,29 @@
 #include "font.c"
 #include "joypad.c"
 #include "sprite.c"
-#include "bcd.c"
+#include "arith.c"
+#include "rng.c"
 
-#define X   (opcode.byte.high & 0x0F)
-#define Y   (opcode.byte.low >> 4)
-#define N   (opcode.byte.low & 0x0F)
-#define NN  (opcode.byte.low)
-#define NNN (opcode.word & 0x0FFF)
+#define X    opx
+#define Y    opy
+#define N    opn
+#define NN   opnn
+#define NNN  opnnn
+#define SKIP opskip
 
 #define SUCCESS            0
 #define UNSUPPORTED_OPCODE 1
 #define INVALID_OPCODE     2
+#define WAIT_FOR_KEY       3
+#define IDLE               4
+#define CORE_SLOW          5
+
+#define DEFAULT_IPF 16
+#define MIN_IPF     1
+#define MAX_IPF     250
+
+#define TIMER_RELOAD 127
+#define BUSY_OVERRUN 0xFF
 
 unsigned int  PC;
 unsigned char SP;
@@ -48,6 +60,20 @@ unsigned int  STACK[16];
 unsigned char delay_timer;
 unsigned char sound_timer;
 unsigned int  keymask;
+unsigned int  ipf;
+unsigned int  icount;
+unsigned char frames;
+unsigned char busy;
+unsigned int  overruns;
+unsigned char keywait;
+unsigned char fuse;
+unsigned char idle;
+unsigned char opx;
+unsigned char opy;
+unsigned char opn;
+unsigned char opnn;
+unsigned int  opnnn;
+unsigned int  opskip;
 
 union
 {
@@ -60,6 +86,13 @@ union
   } byte;
 } opcode;
 
+typedef char (*chip8_op_t)(void);
+
+#include "cache.c"
+#include "fuse.c"
+#include "idle.c"
+#include "core.c"
+
 void
 chip8_psg_init()
 {
@@ -76,6 +109,8 @@ static
 void
 chip8_vsync_hook(void) __mapcall __irq
 {
+  frames++;
+
   if(delay_timer != 0)
     delay_timer--;
 
@@ -101,30 +136,92 @@ chip8_init()
   sound_timer = 0;
   opcode.word = 0x0000;
   keymask     = 0;
-
+  icount      = 0;
+  busy        = 0;
+  overruns    = 0;
+  keywait     = 0;
+  fuse        = 1;
+  idle        = 1;
+
+  cache_flush();
   chip8_font_init(&RAM[0]);
 
   chip8_psg_init();
 }
 
+void
+chip8_set_ipf(int n)
+{
+  if(n < MIN_IPF)
+    n = MIN_IPF;
+  else if(n > MAX_IPF)
+    n = MAX_IPF;
+
+  ipf = n;
+}
+
 void
 chip8(void)
 {
   irq_add_vsync_handler(chip8_vsync_hook);
   irq_enable_user(IRQ_VSYNC);
 
+  rng_init();
   chip8_loop();
 }
 
+/*
+  Pacing
+
+  Each pass runs one frame's worth of instructions (ipf) and then
+  yields until the vsync hook bumps frames. A batch which is still
+  running when vsync arrives means the budget couldn't be met and is
+  counted in overruns. The HuC6280 timer, restarted at the top of
+  each frame, measures how much of the frame the batch used: busy is
+  in timer ticks of 1024 cycles, roughly 116 to a frame, or
+  BUSY_OVERRUN.
+
+  IDLE simply ends the frame early. A key wait can last any number of
+  frames so it starts a new frame rather than counting as an overrun.
+*/
 static
 void
 chip8_loop()
 {
   char done;
+  unsigned char frame;
 
   done = SUCCESS;
-  while(!done)
-    done = chip8_process();
+  while(1)
+    {
+      frame = frames;
+      timer_stop();
+      timer_set(TIMER_RELOAD);
+      timer_start();
+
+      done = chip8_run(ipf);
+      if(done == WAIT_FOR_KEY)
+        {
+          v[keywait] = wait_for_key();
+          continue;
+        }
+
+      if((done != SUCCESS) && (done != IDLE))
+        break;
+
+      if(frame != frames)
+        {
+          busy = BUSY_OVERRUN;
+          overruns++;
+          continue;
+        }
+
+      busy = (TIMER_RELOAD - timer_get());
+      while(frame == frames)
+        ;
+    }
+
+  timer_stop();
 
   switch(done)
     {
@@ -137,628 +234,1107 @@ chip8_loop()
       break;
     }
 
+  print_pacing();
+
   vsync(60 * 3);
 }
 
+/*
+  Opcode handlers
+
+  Each handler executes a single, already fetched, opcode and returns
+  its status. They are reached through the dispatch tables below
+  rather than a nested switch. HuC compiles a switch into a linear
+  search of its case list so late cases such as 8XYE or FX65 would
+  otherwise pay for every compare ahead of them.
+*/
+
+static
+char
+op_invalid(void)
+{
+  return INVALID_OPCODE;
+}
+
 static
-void
-chip8_process()
+char
+op_unsupported(void)
+{
+  return UNSUPPORTED_OPCODE;
+}
+
+/*
+  00E0 - CLS
+  Clear the display.
+*/
+static
+char
+op_00e0(void)
+{
+  gfx_clear(0x1000);
+  return SUCCESS;
+}
+
+/*
+  00EE - RET
+  Return from a subroutine.
+
+  The interpreter sets the program counter to the address at
+  the top of the stack, then subtracts 1 from the stack
+  pointer.
+*/
+static
+char
+op_00ee(void)
+{
+  PC = STACK[--SP];
+  return SUCCESS;
+}
+
+/*
+  00FB - SCR
+  Scroll display right
+
+  SCHIP-8 instruction to scroll display 4 pixels to the
+  right.
+
+  00FC - SCL
+  Scroll display left
+
+  SCHIP-8 instruction to scroll display 4 pixels to the
+  left.
+
+  00FD - EXIT
+  Exit CHIP interpreter
+
+  SCHIP-8 instruction to stop the interpreter.
+
+  00FE - LOW
+  Enable low res (64x32) mode
+
+  SCHIP-8 instruction to enable default / low res mode.
+
+  00FF - HIGH
+  Enable high res (128x64) mode
+
+  SCHIP-8 instruction to enable high res mode.
+
+  All currently handled by op_unsupported.
+*/
+
+/* 0x1nnn : jmp nnn : jump to address nnn */
+static
+char
+op_1nnn(void)
+{
+  PC = NNN;
+  return SUCCESS;
+}
+
+/*
+  2nnn - CALL addr
+  Call subroutine at nnn.
+
+  The interpreter increments the stack pointer, then puts the current PC
+  on the top of the stack. The PC is then set to nnn.
+*/
+static
+char
+op_2nnn(void)
+{
+  STACK[SP++] = PC;
+  PC = NNN;
+  return SUCCESS;
+}
+
+/*
+  3xNN - SE VX, byte
+  Skip next instruction if VX = NN.
+
+  The interpreter compares register VX to NN, and if they are
+  equal, increments the program counter by 2.
+*/
+static
+char
+op_3xnn(void)
+{
+  if(v[X] == NN)
+    PC = SKIP;
+  return SUCCESS;
+}
+
+/*
+  4xNN - SNE VX, byte
+  Skip next instruction if VX != NN.
+
+  The interpreter compares register VX to NN, and if they are
+  not equal, increments the program counter by 2.
+*/
+static
+char
+op_4xnn(void)
+{
+  if(v[X] != NN)
+    PC = SKIP;
+  return SUCCESS;
+}
+
+/*
+  5XY0 - SE VX, VY
+  Skip next instruction if VX = VY.
+
+  The interpreter compares register VX to register VY, and if
+  they are equal, increments the program counter by 2.
+*/
+static
+char
+op_5xy0(void)
+{
+  if(v[X] == v[Y])
+    PC = SKIP;
+  return SUCCESS;
+}
+
+/*
+  5XY1 - SGT VX, VY
+  Skip next instruction if VX > VY.
+
+  The interpreter compares register VX to register VY, and if
+  VX > VY, increments the program counter by 2.
+*/
+static
+char
+op_5xy1(void)
+{
+  if(v[X] > v[Y])
+    PC = SKIP;
+  return SUCCESS;
+}
+
+/*
+  5XY2 - SLT VX, VY
+  Skip next instruction if VX < VY.
+
+  The interpreter compares register VX to register VY, and if
+  VX < VY, increments the program counter by 2.
+*/
+static
+char
+op_5xy2(void)
+{
+  if(v[X] < v[Y])
+    PC = SKIP;
+  return SUCCESS;
+}
+
+/*
+  5XY3 - SNE VX, VY
+  Skip next instruction if VX != VY.
+
+  The interpreter compares register VX to register VY, and if
+  VX != VY, increments the program counter by 2.
+*/
+static
+char
+op_5xy3(void)
+{
+  if(v[X] != v[Y])
+    PC = SKIP;
+  return SUCCESS;
+}
+
+/*
+  6XNN - LD VX, NN
+  Set VX = NN.
+
+  The interpreter puts the value NN into register VX.
+*/
+static
+char
+op_6xnn(void)
+{
+  v[X] = NN;
+  return SUCCESS;
+}
+
+/*
+  7xNN - ADD VX, byte
+  Set VX = VX + NN.
+
+  Adds the value NN to the value of register VX, then stores the
+  result in VX.
+*/
+static
+char
+op_7xnn(void)
+{
+  v[X] += NN;
+  return SUCCESS;
+}
+
+/*
+  8XY0 - LD VX, VY
+  Set VX = VY.
+
+  Stores the value of register VY in register VX.
+*/
+static
+char
+op_8xy0(void)
+{
+  v[X] = v[Y];
+  return SUCCESS;
+}
+
+/*
+  8XY1 - OR VX, VY
+  Set VX = VX OR VY.
+
+  Performs a bitwise OR on the values of VX and VY, then stores
+  the result in VX. A bitwise OR compares the corrseponding bits
+  from two values, and if either bit is 1, then the same bit in
+  the result is also 1. Otherwise, it is 0.
+*/
+static
+char
+op_8xy1(void)
+{
+  v[X] |= v[Y];
+  return SUCCESS;
+}
+
+/*
+  8XY2 - AND VX, VY
+  Set VX = VX AND VY.
+
+  Performs a bitwise AND on the values of VX and VY, then stores the
+  result in VX. A bitwise AND compares the corrseponding bits from two
+  values, and if both bits are 1, then the same bit in the result is
+  also 1. Otherwise, it is 0.
+*/
+static
+char
+op_8xy2(void)
+{
+  v[X] &= v[Y];
+  return SUCCESS;
+}
+
+/*
+  8XY3 - XOR VX, VY
+  Set VX = VX XOR VY.
+
+  Performs a bitwise exclusive OR on the values of VX and
+  VY, then stores the result in VX. An exclusive OR
+  compares the corrseponding bits from two values, and if
+  the bits are not both the same, then the corresponding
+  bit in the result is set to 1. Otherwise, it is 0.
+*/
+static
+char
+op_8xy3(void)
+{
+  v[X] ^= v[Y];
+  return SUCCESS;
+}
+
+/*
+  8XY4 - ADD VX, VY
+  Set VX = VX + VY, set VF = carry.
+
+  The values of VX and VY are added together. If the result is
+  greater than 8 bits (i.e., > 255,) VF is set to 1, otherwise
+  0. Only the lowest 8 bits of the result are kept, and stored
+  in VX.
+
+  HuC adds chars as 16 bit ints so the carry is bit 8 of the sum.
+*/
+static
+char
+op_8xy4(void)
+{
+  static unsigned int sum;
+
+  sum    = (v[X] + v[Y]);
+  v[0xF] = (sum > 0xFF);
+  v[X]  += v[Y];
+  return SUCCESS;
+}
+
+/*
+  8XY5 - SUB VX, VY
+  Set VX = VX - VY, set VF = NOT borrow.
+
+  If VX > VY, then VF is set to 1, otherwise 0. Then VY is
+  subtracted from VX, and the results stored in VX.
+*/
+static
+char
+op_8xy5(void)
+{
+  v[0xF] = (v[X] >= v[Y]);
+  v[X] -= v[Y];
+  return SUCCESS;
+}
+
+/*
+  8XY6 - SHR VX {, VY}
+  Originally: Set VX = VY SHR 1
+  Today: Set VX = VX SHR 1
+
+  If the least-significant bit of VY is 1, then VF is set to 1,
+  otherwise 0. Then VY is shifted right by 1 and stored in VX.
+*/
+static
+char
+op_8xy6(void)
+{
+  v[0xF] = (v[X] & 0x01);
+  v[X] >>= 1;
+  return SUCCESS;
+}
+
+/*
+  8XY7 - SUBN VX, VY
+  Set VX = VY - VX, set VF = NOT borrow.
+
+  If VY > VX, then VF is set to 1, otherwise 0. Then VX is
+  subtracted from VY, and the results stored in VX.
+*/
+static
+char
+op_8xy7(void)
+{
+  v[0xF] = (v[Y] >= v[X]);
+  v[X]   = (v[Y] - v[X]);
+  return SUCCESS;
+}
+
+/*
+  8XYE - SHL VX {, VY}
+  Originally: Set VX = VY SHL 1
+  Today: Set VX = VX SHL 1
+
+  If the most-significant bit of VX is 1, then VF is set to 1,
+  otherwise to 0. Then VX is multiplied by 2.
+*/
+static
+char
+op_8xye(void)
+{
+  v[0xF] = ((v[X] & 0x80) ? 1 : 0);
+  v[X] <<= 1;
+  return SUCCESS;
+}
+
+/*
+  9XY0 - SNE VX, VY
+  Skip next instruction if VX != VY.
+
+  The values of VX and VY are compared, and if they are not equal, the
+  program counter is increased by 2.
+*/
+static
+char
+op_9xy0(void)
+{
+  if(v[X] != v[Y])
+    PC = SKIP;
+  return SUCCESS;
+}
+
+/*
+  9XY1 - MUL VX, VY
+  Set VF,VX = VX * VY
+
+  Set VF, VX equal to VX times VY where VF is the most
+  significant part of a 16bit word.
+*/
+static
+char
+op_9xy1(void)
+{
+  static unsigned int result;
+
+  result = arith_mul(v[X],v[Y]);
+  v[0xF] = (result >> 8);
+  v[X]   = result;
+  return SUCCESS;
+}
+
+/*
+  9XY2 - DIV VX, VY
+  Set VF,VX = VX / VY
+
+  Set VX equal to VX divided by VY where VF is the remainder.
+  Dividing by 0 sets VX to 0xFF and VF to VX.
+*/
+static
+char
+op_9xy2(void)
+{
+  static unsigned int result;
+
+  result = arith_div(v[X],v[Y]);
+  v[X]   = result;
+  v[0xF] = (result >> 8);
+  return SUCCESS;
+}
+
+/*
+  9XY3 - BCD VX, VY
+  Convert VX, VY as a 16bit word to BCD at I
+
+  Let VX, VY be treated as a 16bit word with VX the most
+  significant part and convert to decimal; 5 decimal digits
+  are stored at M(I), M(I+1), M(I+2), M(I+3), and M(I+4), I
+  does not change.
+*/
+static
+char
+op_9xy3(void)
+{
+  arith_bcd16(&RAM[I],((v[X] << 8) | v[Y]));
+  cache_invalidate(I,5);
+  return SUCCESS;
+}
+
+/*
+  ANNN - LD I, addr
+  Set I = NNN.
+
+  The value of register I is set to nnn.
+*/
+static
+char
+op_annn(void)
+{
+  I = NNN;
+  return SUCCESS;
+}
+
+/*
+  BNNN - JP V0, addr
+  Jump to location NNN + V0.
+
+  The program counter is set to NNN plus the value of V0.
+*/
+static
+char
+op_bnnn(void)
+{
+  PC = NNN + (int)v[0];
+  return SUCCESS;
+}
+
+/*
+  CXNN - RND VX, NN
+  Set VX = random byte AND NN.
+
+  The interpreter generates a random number from 0 to 255, which
+  is then ANDed with the value NN. The results are stored in
+  VX. See rng.c.
+*/
+static
+char
+op_cxnn(void)
+{
+  v[X] = rng_and(NN);
+  return SUCCESS;
+}
+
+/*
+  DXYN - DRW VX, VY, N
+  Display N-byte sprite starting at memory location I at (VX, VY), set VF = collision.
+
+  The interpreter reads n bytes from memory, starting at the address
+  stored in I. These bytes are then displayed as sprites on screen
+  at coordinates (VX, VY). Sprites are XORed onto the existing
+  screen. If this causes any pixels to be erased, VF is set to 1,
+  otherwise it is set to 0. If the sprite is positioned so part of
+  it is outside the coordinates of the display, it wraps around to
+  the opposite side of the screen. See instruction 8XY3 for more
+  information on XOR, and section 2.4, Display, for more information
+  on the Chip-8 screen and sprites.
+*/
+static
+char
+op_dxyn(void)
+{
+  v[0xF] = chip8_put_sprite(&RAM[I],v[X],v[Y],N);
+  return SUCCESS;
+}
+
+/*
+  Ex9E - SKP VX
+  Skip next instruction if key with the value of VX is pressed.
+
+  Checks the keyboard, and if the key corresponding to the value of VX
+  is currently in the down position, PC is increased by 2.
+*/
+static
+char
+op_ex9e(void)
+{
+  keymask |= (1 << v[X]);
+  if(key_pressed(v[X]))
+    PC = SKIP;
+  return SUCCESS;
+}
+
+/*
+  ExA1 - SKNP VX
+  Skip next instruction if key with the value of VX is not pressed.
+
+  Checks the keyboard, and if the key corresponding to the value of VX
+  is currently in the up position, PC is increased by 2.
+*/
+static
+char
+op_exa1(void)
+{
+  keymask |= (1 << v[X]);
+  if(!key_pressed(v[X]))
+    PC = SKIP;
+  return SUCCESS;
+}
+
+/*
+  FX07 - LD VX, DT
+  Set VX = delay timer value.
+
+  The value of DT is placed into VX.
+*/
+static
+char
+op_fx07(void)
+{
+  v[X] = delay_timer;
+  return SUCCESS;
+}
+
+/*
+  FX0A - LD VX, N
+  Wait for a key press, store the value of the key in VX.
+
+  All execution stops until a key is pressed, then the value of that key is stored in VX.
+
+  The wait itself is done by chip8_loop so that a batch in chip8_run
+  never blocks. The register to load is left in keywait.
+*/
+static
+char
+op_fx0a(void)
+{
+  keywait = X;
+  return WAIT_FOR_KEY;
+}
+
+/*
+  FX15 - LD DT, VX
+  Set delay timer = VX.
+
+  DT is set equal to the value of VX.
+*/
+static
+char
+op_fx15(void)
+{
+  delay_timer = v[X];
+  return SUCCESS;
+}
+
+/*
+  FX18 - LD ST, VX
+  Set sound timer = VX.
+
+  ST is set equal to the value of VX.
+*/
+static
+char
+op_fx18(void)
+{
+  sound_timer = v[X];
+  if(sound_timer != 0)
+    *psg_ctrl = PSG_CTRL_ENABLED_FULL_VOL;
+  return SUCCESS;
+}
+
+/*
+  FX1E - ADD I, VX
+  Set I = I + VX.
+
+  The values of I and VX are added, and the results are stored in I.
+*/
+static
+char
+op_fx1e(void)
+{
+  I += v[X];
+  v[0xF] = (I > 0x0FFF);
+  I &= 0x0FFF;
+  return SUCCESS;
+}
+
+/*
+  FX29 - LD F, VX
+  Set I = location of sprite for digit VX.
+
+  The value of I is set to the location for the hexadecimal sprite
+  corresponding to the value of VX.
+*/
+static
+char
+op_fx29(void)
+{
+  I = chip8_font_8x5_loc(v[X]);
+  return SUCCESS;
+}
+
+/*
+  FX30 - LD HF, VX
+  Set I = location of sprite for large digit VX.
+
+  The value of I is set to the location for the hexadecimal sprite
+  corresponding to the value of VX.
+*/
+static
+char
+op_fx30(void)
+{
+  I = chip8_font_16x10_loc(v[X]);
+  return SUCCESS;
+}
+
+/*
+  FX33 - LD B, VX
+  Store BCD representation of VX in memory locations I, I+1, and I+2.
+
+  The interpreter takes the decimal value of VX, and places the
+  hundreds digit in memory at location in I, the tens digit at
+  location I+1, and the ones digit at location I+2.
+*/
+static
+char
+op_fx33(void)
+{
+  arith_bcd8(&RAM[I],v[X]);
+  cache_invalidate(I,3);
+  return SUCCESS;
+}
+
+/*
+  FX55 - LD [I], VX
+  Store registers V0 through VX in memory starting at location I.
+
+  The interpreter copies the values of registers V0 through VX
+  into memory, starting at the address in I.
+*/
+static
+char
+op_fx55(void)
+{
+  memcpy(&RAM[I],&v[0],X+1);
+  cache_invalidate(I,X+1);
+  return SUCCESS;
+}
+
+/*
+  FX65 - LD VX, [I]
+  Read registers V0 through VX from memory starting at location I.
+
+  The interpreter reads values from memory starting at location
+  I into registers V0 through VX.
+*/
+static
+char
+op_fx65(void)
+{
+  memcpy(&v[0],&RAM[I],X+1);
+  return SUCCESS;
+}
+
+/*
+  FX75 - DISP VX
+  CHIP-8E Display the value of VX on the hex display.
+
+  FX75 - LD R, VX
+  SCHIP-8 Store V0 through VX to HP-48 RPL user flags (X <= 7).
+*/
+static
+char
+op_fx75(void)
+{
+  memcpy(&v[0],&v48[0],((X+1) & 0x03));
+  return SUCCESS;
+}
+
+/*
+  FX85 - LD VX, R
+  SCHIP-8 Store HP-48 RPL user flags in V0 through VX (X <= 7).
+*/
+static
+char
+op_fx85(void)
+{
+  memcpy(&v48[0],&v[0],((X+1) & 0x03));
+  return SUCCESS;
+}
+
+/*
+  FX94 - LD ASCII, VX
+  Load I with location of ASCII char
+
+  Currently handled by op_unsupported.
+*/
+
+/*
+  Dispatch tables
+
+  The primary table is indexed by the high nibble of the opcode. The
+  groups which need further decoding index a secondary table. 5XYN,
+  8XYN and 9XYN use the low nibble directly. 00NN, EXNN and FXNN are
+  keyed by the whole low byte so a 256 entry slot table maps it down
+  to the few handlers each group actually has. Slot 0 is always
+  op_invalid. The rest of 0NNN is picked out by chip8_ops_0_index().
+*/
+
+const chip8_op_t chip8_ops_0[] =
+  {
+    op_invalid,     /* 0 */
+    op_00e0,        /* 1 : 00E0 */
+    op_00ee,        /* 2 : 00EE */
+    op_unsupported, /* 3 : 00FB - 00FF */
+    op_unsupported  /* 4 : 0NNN */
+  };
+
+const unsigned char chip8_ops_0_slot[256] =
+  {
+    /*   0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 0 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 1 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 2 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 3 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 4 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 5 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 6 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 7 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 8 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 9 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* A */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* B */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* C */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* D */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, /* E */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3  /* F */
+  };
+
+const chip8_op_t chip8_ops_5[16] =
+  {
+    op_5xy0,    op_5xy1,    op_5xy2,    op_5xy3,
+    op_invalid, op_invalid, op_invalid, op_invalid,
+    op_invalid, op_invalid, op_invalid, op_invalid,
+    op_invalid, op_invalid, op_invalid, op_invalid
+  };
+
+const chip8_op_t chip8_ops_8[16] =
+  {
+    op_8xy0,    op_8xy1,    op_8xy2,    op_8xy3,
+    op_8xy4,    op_8xy5,    op_8xy6,    op_8xy7,
+    op_invalid, op_invalid, op_invalid, op_invalid,
+    op_invalid, op_invalid, op_8xye,    op_invalid
+  };
+
+const chip8_op_t chip8_ops_9[16] =
+  {
+    op_9xy0,    op_9xy1,    op_9xy2,    op_9xy3,
+    op_invalid, op_invalid, op_invalid, op_invalid,
+    op_invalid, op_invalid, op_invalid, op_invalid,
+    op_invalid, op_invalid, op_invalid, op_invalid
+  };
+
+const chip8_op_t chip8_ops_e[] =
+  {
+    op_invalid, /* 0 */
+    op_ex9e,    /* 1 : EX9E */
+    op_exa1     /* 2 : EXA1 */
+  };
+
+const unsigned char chip8_ops_e_slot[256] =
+  {
+    /*   0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 0 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 1 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 2 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 3 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 4 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 5 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 6 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 7 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 8 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, /* 9 */
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* A */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* B */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* C */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* D */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* E */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0  /* F */
+  };
+
+const chip8_op_t chip8_ops_f[] =
+  {
+    op_invalid,    /*  0 */
+    op_fx07,       /*  1 : FX07 */
+    op_fx0a,       /*  2 : FX0A */
+    op_fx15,       /*  3 : FX15 */
+    op_fx18,       /*  4 : FX18 */
+    op_fx1e,       /*  5 : FX1E */
+    op_fx29,       /*  6 : FX29 */
+    op_fx30,       /*  7 : FX30 */
+    op_fx33,       /*  8 : FX33 */
+    op_fx55,       /*  9 : FX55 */
+    op_fx65,       /* 10 : FX65 */
+    op_fx75,       /* 11 : FX75 */
+    op_fx85,       /* 12 : FX85 */
+    op_unsupported /* 13 : FX94 */
+  };
+
+const unsigned char chip8_ops_f_slot[256] =
+  {
+    /*    0   1   2   3   4   5   6   7   8   9   A   B   C   D   E   F */
+     0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  2,  0,  0,  0,  0,  0, /* 0 */
+     0,  0,  0,  0,  0,  3,  0,  0,  4,  0,  0,  0,  0,  0,  5,  0, /* 1 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0, /* 2 */
+     7,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 3 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 4 */
+     0,  0,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 5 */
+     0,  0,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 6 */
+     0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 7 */
+     0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 8 */
+     0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 9 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* A */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* B */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* C */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* D */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* E */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0  /* F */
+  };
+
+/*
+  The slot for a 0NNN opcode. The slot table only covers 00NN; the
+  rest call machine code at NNN, which is unsupported.
+*/
+static
+unsigned char
+chip8_ops_0_index(void)
+{
+  if(opcode.byte.high == 0x00)
+    return chip8_ops_0_slot[opcode.byte.low];
+
+  return 4;
+}
+
+static
+char
+op_group_0(void)
+{
+  return (*chip8_ops_0[chip8_ops_0_index()])();
+}
+
+static
+char
+op_group_5(void)
+{
+  return (*chip8_ops_5[N])();
+}
+
+static
+char
+op_group_8(void)
+{
+  return (*chip8_ops_8[N])();
+}
+
+static
+char
+op_group_9(void)
 {
-  opcode.byte.high = RAM[PC++];
-  opcode.byte.low  = RAM[PC++];
+  return (*chip8_ops_9[N])();
+}
+
+static
+char
+op_group_e(void)
+{
+  return (*chip8_ops_e[chip8_ops_e_slot[opcode.byte.low]])();
+}
+
+static
+char
+op_group_f(void)
+{
+  return (*chip8_ops_f[chip8_ops_f_slot[opcode.byte.low]])();
+}
+
+const chip8_op_t chip8_ops[16] =
+  {
+    op_group_0, op_1nnn,    op_2nnn,    op_3xnn,
+    op_4xnn,    op_group_5, op_6xnn,    op_7xnn,
+    op_group_8, op_group_9, op_annn,    op_bnnn,
+    op_cxnn,    op_dxyn,    op_group_e, op_group_f
+  };
 
-  switch(opcode.byte.high & 0xF0)
+/*
+  Resolve the opcode in opcode.word down to its final handler. Used
+  when filling the decode cache so the group handlers' secondary
+  lookup is only done once per decode.
+*/
+static
+chip8_op_t
+chip8_lookup(void)
+{
+  switch(opcode.byte.high >> 4)
     {
-    case 0x00:
-      switch(opcode.byte.low)
-        {
-          /*
-            00E0 - CLS
-            Clear the display.
-          */
-        case 0xE0:
-          gfx_clear(0x1000);
-          return SUCCESS;
-
-          /*
-            00EE - RET
-            Return from a subroutine.
-
-            The interpreter sets the program counter to the address at
-            the top of the stack, then subtracts 1 from the stack
-            pointer.
-          */
-        case 0xEE:
-          PC = STACK[--SP];
-          return SUCCESS;
-
-          /*
-            00FB - SCR
-            Scroll display right
-
-            SCHIP-8 instruction to scroll display 4 pixels to the
-            right.
-          */
-        case 0xFB:
-          return UNSUPPORTED_OPCODE;
-
-          /*
-            00FC - SCL
-            Scroll display left
-
-            SCHIP-8 instruction to scroll display 4 pixels to the
-            left.
-          */
-        case 0xFC:
-          return UNSUPPORTED_OPCODE;
-
-          /*
-            00FD - EXIT
-            Exit CHIP interpreter
-
-            SCHIP-8 instruction to stop the interpreter.
-           */
-        case 0xFD:
-          return UNSUPPORTED_OPCODE;
-
-          /*
-            00FE - LOW
-            Enable low res (64x32) mode
-
-            SCHIP-8 instruction to enable default / low res mode.
-          */
-        case 0xFE:
-          return UNSUPPORTED_OPCODE;
-
-          /*
-            00FF - HIGH
-            Enable high res (128x64) mode
-
-            SCHIP-8 instruction to enable high res mode.
-          */
-        case 0xFF:
-          return UNSUPPORTED_OPCODE;
-
-        default:
-          return INVALID_OPCODE;
-        }
+    case 0x0:
+      return chip8_ops_0[chip8_ops_0_index()];
+    case 0x5:
+      return chip8_ops_5[opcode.byte.low & 0x0F];
+    case 0x8:
+      return chip8_ops_8[opcode.byte.low & 0x0F];
+    case 0x9:
+      return chip8_ops_9[opcode.byte.low & 0x0F];
+    case 0xE:
+      return chip8_ops_e[chip8_ops_e_slot[opcode.byte.low]];
+    case 0xF:
+      return chip8_ops_f[chip8_ops_f_slot[opcode.byte.low]];
+    }
 
-      /* 0x1nnn : jmp nnn : jump to address nnn */
-    case 0x10:
-      PC = NNN;
-      return SUCCESS;
-
-      /*
-        2nnn - CALL addr
-        Call subroutine at nnn.
-
-        The interpreter increments the stack pointer, then puts the current PC
-        on the top of the stack. The PC is then set to nnn.
-      */
-    case 0x20:
-      STACK[SP++] = PC;
-      PC = NNN;
-      return SUCCESS;
-
-      /*
-        3xNN - SE VX, byte
-        Skip next instruction if VX = NN.
-
-        The interpreter compares register VX to NN, and if they are
-        equal, increments the program counter by 2.
-      */
-    case 0x30:
-      if(v[X] == NN)
-        PC += 2;
-      return SUCCESS;
-
-      /*
-        4xNN - SNE VX, byte
-        Skip next instruction if VX != NN.
-
-        The interpreter compares register VX to NN, and if they are
-        not equal, increments the program counter by 2.
-      */
-    case 0x40:
-      if(v[X] != NN)
-        PC += 2;
-      return SUCCESS;
-
-    case 0x50:
-      switch(opcode.byte.low & 0x0F)
-        {
-          /*
-            5XY0 - SE VX, VY
-            Skip next instruction if VX = VY.
-
-            The interpreter compares register VX to register VY, and if
-            they are equal, increments the program counter by 2.
-          */
-        case 0x00:
-          if(v[X] == v[Y])
-            PC += 2;
-          return SUCCESS;
-
-          /*
-            5XY1 - SGT VX, VY
-            Skip next instruction if VX > VY.
-
-            The interpreter compares register VX to register VY, and if
-            VX > VY, increments the program counter by 2.
-          */
-        case 0x01:
-          if(v[X] > v[Y])
-            PC += 2;
-          return SUCCESS;
-
-          /*
-            5XY2 - SLT VX, VY
-            Skip next instruction if VX < VY.
-
-            The interpreter compares register VX to register VY, and if
-            VX < VY, increments the program counter by 2.
-          */
-        case 0x02:
-          if(v[X] < v[Y])
-            PC += 2;
-          return SUCCESS;
-
-          /*
-            5XY3 - SNE VX, VY
-            Skip next instruction if VX != VY.
-
-            The interpreter compares register VX to register VY, and if
-            VX != VY, increments the program counter by 2.
-          */
-        case 0x03:
-          if(v[X] != v[Y])
-            PC += 2;
-          return SUCCESS;
-
-        default:
-          return INVALID_OPCODE;
-        }
+  return chip8_ops[opcode.byte.high >> 4];
+}
 
-      /*
-        6XNN - LD VX, NN
-        Set VX = NN.
-
-        The interpreter puts the value NN into register VX.
-      */
-    case 0x60:
-      v[X] = NN;
-      return SUCCESS;
-
-      /*
-        7xNN - ADD VX, byte
-        Set VX = VX + NN.
-
-        Adds the value NN to the value of register VX, then stores the
-        result in VX.
-      */
-    case 0x70:
-      v[X] += NN;
-      return SUCCESS;
-
-    case 0x80:
-      switch(opcode.byte.low & 0x0F)
-        {
-          /*
-            8XY0 - LD VX, VY
-            Set VX = VY.
-
-            Stores the value of register VY in register VX.
-          */
-        case 0x00:
-          v[X] = v[Y];
-          return SUCCESS;
-
-          /*
-            8XY1 - OR VX, VY
-            Set VX = VX OR VY.
-
-            Performs a bitwise OR on the values of VX and VY, then stores
-            the result in VX. A bitwise OR compares the corrseponding bits
-            from two values, and if either bit is 1, then the same bit in
-            the result is also 1. Otherwise, it is 0.
-          */
-        case 0x01:
-          v[X] |= v[Y];
-          return SUCCESS;
-
-          /*
-            8XY2 - AND VX, VY
-            Set VX = VX AND VY.
-
-            Performs a bitwise AND on the values of VX and VY, then stores the
-            result in VX. A bitwise AND compares the corrseponding bits from two
-            values, and if both bits are 1, then the same bit in the result is
-            also 1. Otherwise, it is 0.
-          */
-        case 0x02:
-          v[X] &= v[Y];
-          return SUCCESS;
-
-          /*
-            8XY3 - XOR VX, VY
-            Set VX = VX XOR VY.
-
-            Performs a bitwise exclusive OR on the values of VX and
-            VY, then stores the result in VX. An exclusive OR
-            compares the corrseponding bits from two values, and if
-            the bits are not both the same, then the corresponding
-            bit in the result is set to 1. Otherwise, it is 0.
-          */
-        case 0x03:
-          v[X] ^= v[Y];
-          return SUCCESS;
-
-          /*
-            8XY4 - ADD VX, VY
-            Set VX = VX + VY, set VF = carry.
-
-            The values of VX and VY are added together. If the result is
-            greater than 8 bits (i.e., > 255,) VF is set to 1, otherwise
-            0. Only the lowest 8 bits of the result are kept, and stored
-            in VX.
-          */
-        case 0x04:
-          v[0xF] = ((v[X] + v[Y]) < v[X]);
-          v[X] += v[Y];
-          return SUCCESS;
-
-          /*
-            8XY5 - SUB VX, VY
-            Set VX = VX - VY, set VF = NOT borrow.
-
-            If VX > VY, then VF is set to 1, otherwise 0. Then VY is
-            subtracted from VX, and the results stored in VX.
-          */
-        case 0x05:
-          v[0xF] = (v[X] >= v[Y]);
-          v[X] -= v[Y];
-          return SUCCESS;
-
-          /*
-            8XY6 - SHR VX {, VY}
-            Originally: Set VX = VY SHR 1
-            Today: Set VX = VX SHR 1
-
-            If the least-significant bit of VY is 1, then VF is set to 1,
-            otherwise 0. Then VY is shifted right by 1 and stored in VX.
-          */
-        case 0x06:
-          v[0xF] = (v[X] & 0x01);
-          v[X] >>= 1;
-          return SUCCESS;
-
-          /*
-            8XY7 - SUBN VX, VY
-            Set VX = VY - VX, set VF = NOT borrow.
-
-            If VY > VX, then VF is set to 1, otherwise 0. Then VX is
-            subtracted from VY, and the results stored in VX.
-          */
-        case 0x07:
-          v[0xF] = (v[Y] >= v[X]);
-          v[X]   = (v[Y] - v[X]);
-          return SUCCESS;
-
-          /*
-            8XYE - SHL VX {, VY}
-            Originally: Set VX = VY SHL 1
-            Today: Set VX = VX SHL 1
-
-            If the most-significant bit of VX is 1, then VF is set to 1,
-            otherwise to 0. Then VX is multiplied by 2.
-          */
-        case 0x0E:
-          v[0xF] = ((v[X] & 0x80) ? 1 : 0);
-          v[X] <<= 1;
-          return SUCCESS;
-
-        default:
-          return INVALID_OPCODE;
-        }
+/*
+  Execute up to count instructions in one call.
+
+  Leaves early on the first non SUCCESS status: a fault, an FX0A key
+  wait or an idle loop waiting on vsync. The number of instructions
+  actually executed is left in icount. A fused entry counts for every
+  opcode it covers so the last one can overshoot count slightly.
+  Keeping the fetch / dispatch loop here rather than calling a per
+  instruction function saves a call, return and status test on every
+  opcode.
+
+  This is the C path. chip8_run below drives the assembly core and
+  only comes here for the opcodes the core leaves to C. A HuCard build
+  has no decode cache (see cache.c) and decodes every opcode straight
+  from RAM.
+*/
+#ifdef CHIP8_SCD
+static
+char
+chip8_run_c(unsigned int count)
+{
+  static char status;
+  static unsigned int idx;
+  static int budget;
 
-    case 0x90:
-      switch(opcode.byte.low & 0x0F)
-        {
-          /*
-            9XY0 - SNE VX, VY
-            Skip next instruction if VX != VY.
-
-            The values of VX and VY are compared, and if they are not equal, the
-            program counter is increased by 2.
-          */
-        case 0x00:
-          if(v[X] != v[Y])
-            PC += 2;
-          return SUCCESS;
-
-          /*
-            9XY1 - MUL VX, VY
-            Set VF,VX = VX * VY
-
-            Set VF, VX equal to VX times VY where VF is the most
-            significant part of a 16bit word.
-          */
-        case 0x01:
-          {
-            struct {char l; char h;} result;
-
-            result = v[X] * v[Y];
-            v[0xF] = result.h;
-            v[X]   = result.l;
-          }
-          return SUCCESS;
-
-          /*
-            9XY2 - DIV VX, VY
-            Set VF,VX = VX / VY
-
-            Set VX equal to VX divided by VY where VF is the remainder.
-          */
-        case 0x02:
-          v[X]   = v[X] / v[Y];
-          v[0xF] = v[X] % v[Y];
-          return SUCCESS;
-
-          /*
-            9XY3 - BCD VX, VY
-            Convert VX, VY as a 16bit word to BCD at I
-
-            Let VX, VY be treated as a 16bit word with VX the most
-            significant part and convert to decimal; 5 decimal digits
-            are stored at M(I), M(I+1), M(I+2), M(I+3), and M(I+4), I
-            does not change.
-          */
-        case 0x03:
-          {
-            struct {char l; char h;} tmp;
-
-            tmp.h = v[X];
-            tmp.l = v[Y];
-
-            bcd_convert_16bit(tmp,&RAM[I]);
-          }
-          return SUCCESS;
-
-        default:
-          return INVALID_OPCODE;
-        }
+  status = SUCCESS;
+  budget = count;
+  while(budget > 0)
+    {
+      idx = ((PC >> 1) & CACHE_MASK);
+      if(cache_tag[idx] != PC)
+        cache_fill(PC,idx);
+
+      opx    = cache_x[idx];
+      opy    = cache_y[idx];
+      opn    = cache_n[idx];
+      opnn   = cache_nn[idx];
+      opnnn  = cache_nnn[idx];
+      opskip = cache_skip[idx];
+      PC    += 2;
+
+      budget -= cache_len[idx];
+      status  = (*cache_op[idx])();
+      if(status != SUCCESS)
+        break;
+    }
+  icount = count - budget;
 
-      /*
-        ANNN - LD I, addr
-        Set I = NNN.
-
-        The value of register I is set to nnn.
-      */
-    case 0xA0:
-      I = NNN;
-      return SUCCESS;
-
-      /*
-        BNNN - JP V0, addr
-        Jump to location NNN + V0.
-
-        The program counter is set to NNN plus the value of V0.
-      */
-    case 0xB0:
-      PC = NNN + (int)v[0];
-      return SUCCESS;
-
-      /*
-        CXNN - RND VX, NN
-        Set VX = random byte AND NN.
-
-        The interpreter generates a random number from 0 to 255, which
-        is then ANDed with the value NN. The results are stored in
-        VX.
-      */
-    case 0xC0:
-      v[X] = ((char)rand() & NN);
-      return SUCCESS;
-
-    case 0xD0:
-      /*
-        DXYN - DRW VX, VY, N
-        Display N-byte sprite starting at memory location I at (VX, VY), set VF = collision.
-
-        The interpreter reads n bytes from memory, starting at the address
-        stored in I. These bytes are then displayed as sprites on screen
-        at coordinates (VX, VY). Sprites are XORed onto the existing
-        screen. If this causes any pixels to be erased, VF is set to 1,
-        otherwise it is set to 0. If the sprite is positioned so part of
-        it is outside the coordinates of the display, it wraps around to
-        the opposite side of the screen. See instruction 8XY3 for more
-        information on XOR, and section 2.4, Display, for more information
-        on the Chip-8 screen and sprites.
-      */
-      v[0xF] = chip8_put_sprite(&RAM[I],v[X],v[Y],N);
-      return SUCCESS;
-
-    case 0xE0:
-      switch(opcode.byte.low)
-        {
-          /*
-            Ex9E - SKP VX
-            Skip next instruction if key with the value of VX is pressed.
-
-            Checks the keyboard, and if the key corresponding to the value of VX
-            is currently in the down position, PC is increased by 2.
-          */
-        case 0x9E:
-          keymask |= (1 << v[X]);
-          if(key_pressed(v[X]))
-            PC += 2;
-          return SUCCESS;
-
-          /*
-            ExA1 - SKNP VX
-            Skip next instruction if key with the value of VX is not pressed.
-
-            Checks the keyboard, and if the key corresponding to the value of VX
-            is currently in the up position, PC is increased by 2.
-          */
-        case 0xA1:
-          keymask |= (1 << v[X]);
-          if(!key_pressed(v[X]))
-            PC += 2;
-          return SUCCESS;
-
-        default:
-          return INVALID_OPCODE;
-        }
+  if(status != SUCCESS)
+    {
+      opcode.byte.high = RAM[cache_tag[idx]];
+      opcode.byte.low  = RAM[cache_tag[idx]+1];
+    }
+
+  return status;
+}
+#else
+static
+char
+chip8_run_c(unsigned int count)
+{
+  static char status;
+  static int budget;
+
+  status = SUCCESS;
+  budget = count;
+  while(budget > 0)
+    {
+      opcode.byte.high = RAM[PC];
+      opcode.byte.low  = RAM[PC+1];
+
+      opx    = (opcode.byte.high & 0x0F);
+      opy    = (opcode.byte.low >> 4);
+      opn    = (opcode.byte.low & 0x0F);
+      opnn   = opcode.byte.low;
+      opnnn  = (opcode.word & 0x0FFF);
+      opskip = (PC + 4);
+      PC    += 2;
+
+      budget--;
+      status = (*chip8_ops[opcode.byte.high >> 4])();
+      if(status != SUCCESS)
+        break;
+    }
+  icount = count - budget;
 
-    case 0xF0:
-      switch(opcode.byte.low)
+  return status;
+}
+#endif
+
+/*
+  Execute up to count instructions, mostly in the assembly core.
+
+  core_run stops with CORE_SLOW in front of any opcode it doesn't
+  implement; that single instruction goes through chip8_run_c and the
+  core picks up again after it. Statuses and icount are as for
+  chip8_run_c.
+*/
+static
+char
+chip8_run(unsigned int count)
+{
+  static char status;
+  static unsigned int done;
+
+  status = SUCCESS;
+  done   = 0;
+  while(done < count)
+    {
+      status = core_run(count - done);
+      done  += core_count;
+      if(status == CORE_SLOW)
         {
-          /*
-            FX07 - LD VX, DT
-            Set VX = delay timer value.
-
-            The value of DT is placed into VX.
-          */
-        case 0x07:
-          v[X] = delay_timer;
-          return SUCCESS;
-
-          /*
-            FX0A - LD VX, N
-            Wait for a key press, store the value of the key in VX.
-
-            All execution stops until a key is pressed, then the value of that key is stored in VX.
-          */
-        case 0x0A:
-          v[X] = wait_for_key();
-          return SUCCESS;
-
-          /*
-            FX15 - LD DT, VX
-            Set delay timer = VX.
-
-            DT is set equal to the value of VX.
-          */
-        case 0x15:
-          delay_timer = v[X];
-          return SUCCESS;
-
-          /*
-            FX18 - LD ST, VX
-            Set sound timer = VX.
-
-            ST is set equal to the value of VX.
-          */
-        case 0x18:
-          sound_timer = v[X];
-          if(sound_timer != 0)
-            *psg_ctrl = PSG_CTRL_ENABLED_FULL_VOL;
-          return SUCCESS;
-
-          /*
-            FX1E - ADD I, VX
-            Set I = I + VX.
-
-            The values of I and VX are added, and the results are stored in I.
-          */
-        case 0x1E:
-          I += v[X];
-          v[0xF] = (I > 0x0FFF);
-          I &= 0x0FFF;
-          return SUCCESS;
-
-          /*
-            FX29 - LD F, VX
-            Set I = location of sprite for digit VX.
-
-            The value of I is set to the location for the hexadecimal sprite
-            corresponding to the value of VX.
-          */
-        case 0x29:
-          I = chip8_font_8x5_loc(v[X]);
-          return SUCCESS;
-
-          /*
-            FX30 - LD HF, VX
-            Set I = location of sprite for large digit VX.
-
-            The value of I is set to the location for the hexadecimal sprite
-            corresponding to the value of VX.
-          */
-        case 0x30:
-          I = chip8_font_16x10_loc(v[X]);
-          return SUCCESS;
-
-          /*
-            FX33 - LD B, VX
-            Store BCD representation of VX in memory locations I, I+1, and I+2.
-
-            The interpreter takes the decimal value of VX, and places the
-            hundreds digit in memory at location in I, the tens digit at
-            location I+1, and the ones digit at location I+2.
-          */
-        case 0x33:
-          bcd_convert_8bit(v[X],&RAM[I]);
-          return SUCCESS;
-
-          /*
-            FX55 - LD [I], VX
-            Store registers V0 through VX in memory starting at location I.
-
-            The interpreter copies the values of registers V0 through VX
-            into memory, starting at the address in I.
-          */
-        case 0x55:
-          memcpy(&RAM[I],&v[0],X+1);
-          return SUCCESS;
-
-          /*
-            FX65 - LD VX, [I]
-            Read registers V0 through VX from memory starting at location I.
-
-            The interpreter reads values from memory starting at location
-            I into registers V0 through VX.
-          */
-        case 0x65:
-          memcpy(&v[0],&RAM[I],X+1);
-          return SUCCESS;
-
-          /*
-            FX75 - DISP VX
-            CHIP-8E Display the value of VX on the hex display.
-
-            FX75 - LD R, VX
-            SCHIP-8 Store V0 through VX to HP-48 RPL user flags (X <= 7).
-          */
-        case 0x75:
-          memcpy(&v[0],&v48[0],((X+1) & 0x03));
-          return SUCCESS;
-
-          /*
-            FX85 - LD VX, R
-            SCHIP-8 Store HP-48 RPL user flags in V0 through VX (X <= 7).
-          */
-        case 0x85:
-          memcpy(&v48[0],&v[0],((X+1) & 0x03));
-          return SUCCESS;
-
-          /*
-            FX94 - LD ASCII, VX
-            Load I with location of ASCII char
-          */
-        case 0x94:
-          return UNSUPPORTED_OPCODE;
-
-        default:
-          return INVALID_OPCODE;
+          status = chip8_run_c(1);
+          done  += icount;
         }
 
-    default:
-      return INVALID_OPCODE;
+      if(status != SUCCESS)
+        break;
     }
+  icount = done;
 
-  return INVALID_OPCODE;
+  return status;
 }
 
 void
@@ -775,6 +1351,15 @@ print_unsupported_opcode(int opc)
   put_hex(opc, 4, 22, 27);
 }
 
+void
+print_pacing()
+{
+  put_string("IPF:", 0, 26);
+  put_number(ipf, 3, 4, 26);
+  put_string("Overruns:", 8, 26);
+  put_number(overruns, 5, 17, 26);
+}
+
 void
 print_keymask()
 {
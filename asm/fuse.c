@@ -0,0 +1,195 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2014 Antonio SJ Musumeci <trapexit@spawn.link>
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+   copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+   THE SOFTWARE.
+*/
+
+
+/*
+  Superinstruction fusion
+
+  When enabled cache_fill() hands each freshly decoded entry to
+  fuse_entry() which looks at the opcodes following it. Common
+  sequences are replaced by a single handler executing the whole
+  sequence, saving a fetch and dispatch per opcode folded in. The
+  fused handlers leave exactly the same registers, I and PC as the
+  individual opcodes would.
+
+  The second (and third) opcode's operands are packed into whichever
+  of the entry's fields the first opcode doesn't use. The entry's
+  len is the number of opcodes covered so the run loop can charge
+  the batch correctly. A fused entry depends on up to CACHE_SPAN bytes
+  of RAM which cache_invalidate() accounts for.
+
+  Jumping into the middle of a fused sequence is fine. The target
+  address simply gets its own entry.
+
+  CD builds only, like the cache.
+*/
+
+#ifdef CHIP8_SCD
+
+/*
+  6XNN 6YMM - LD VX, NN ; LD VY, MM
+  Y holds the second register and N the second immediate.
+*/
+static
+char
+op_fuse_6xnn_6ymm(void)
+{
+  v[X] = NN;
+  v[Y] = N;
+  PC   = SKIP;
+  return SUCCESS;
+}
+
+/*
+  ANNN DXYN - LD I, NNN ; DRW VX, VY, N
+*/
+static
+char
+op_fuse_annn_dxyn(void)
+{
+  I      = NNN;
+  v[0xF] = chip8_put_sprite(&RAM[I],v[X],v[Y],N);
+  PC     = SKIP;
+  return SUCCESS;
+}
+
+/*
+  3XNN 1MMM - SE VX, NN ; JP MMM
+  NNN holds the jump target.
+*/
+static
+char
+op_fuse_3xnn_1mmm(void)
+{
+  if(v[X] == NN)
+    PC = SKIP;
+  else
+    PC = NNN;
+  return SUCCESS;
+}
+
+/*
+  4XNN 1MMM - SNE VX, NN ; JP MMM
+  NNN holds the jump target.
+*/
+static
+char
+op_fuse_4xnn_1mmm(void)
+{
+  if(v[X] != NN)
+    PC = SKIP;
+  else
+    PC = NNN;
+  return SUCCESS;
+}
+
+/*
+  FX07 3XNN 1MMM - LD VX, DT ; SE VX, NN ; JP MMM
+  The usual delay timer poll. NN and NNN come from the SE and JP.
+*/
+static
+char
+op_fuse_fx07_3xnn_1mmm(void)
+{
+  v[X] = delay_timer;
+  if(v[X] == NN)
+    PC = SKIP;
+  else
+    PC = NNN;
+  return SUCCESS;
+}
+
+void
+fuse_entry(unsigned int addr,
+           unsigned int idx)
+{
+  static unsigned char hi;
+  static unsigned char lo;
+  static unsigned char hi2;
+  static unsigned char lo2;
+  static unsigned char hi3;
+  static unsigned char lo3;
+
+  if(addr > (sizeof(RAM) - CACHE_SPAN))
+    return;
+
+  hi  = RAM[addr+0];
+  lo  = RAM[addr+1];
+  hi2 = RAM[addr+2];
+  lo2 = RAM[addr+3];
+  hi3 = RAM[addr+4];
+  lo3 = RAM[addr+5];
+
+  switch(hi & 0xF0)
+    {
+    case 0x60:
+      if((hi2 & 0xF0) != 0x60)
+        return;
+      cache_op[idx]  = op_fuse_6xnn_6ymm;
+      cache_y[idx]   = (hi2 & 0x0F);
+      cache_n[idx]   = lo2;
+      break;
+
+    case 0xA0:
+      if((hi2 & 0xF0) != 0xD0)
+        return;
+      cache_op[idx]  = op_fuse_annn_dxyn;
+      cache_x[idx]   = (hi2 & 0x0F);
+      cache_y[idx]   = (lo2 >> 4);
+      cache_n[idx]   = (lo2 & 0x0F);
+      break;
+
+    case 0x30:
+    case 0x40:
+      if((hi2 & 0xF0) != 0x10)
+        return;
+      if((hi & 0xF0) == 0x30)
+        cache_op[idx] = op_fuse_3xnn_1mmm;
+      else
+        cache_op[idx] = op_fuse_4xnn_1mmm;
+      cache_nnn[idx] = (((hi2 & 0x0F) << 8) | lo2);
+      break;
+
+    case 0xF0:
+      if(lo != 0x07)
+        return;
+      if(hi2 != (0x30 | (hi & 0x0F)))
+        return;
+      if((hi3 & 0xF0) != 0x10)
+        return;
+      cache_op[idx]   = op_fuse_fx07_3xnn_1mmm;
+      cache_nn[idx]   = lo2;
+      cache_nnn[idx]  = (((hi3 & 0x0F) << 8) | lo3);
+      cache_skip[idx] = (addr + 6);
+      cache_len[idx]  = 3;
+      return;
+
+    default:
+      return;
+    }
+
+  cache_len[idx] = 2;
+}
+
+#endif
@@ -27,6 +27,8 @@
 
 #define PER_PAGE 26
 
+extern unsigned int ipf;
+
 int
 menu(void)
 {
@@ -58,6 +60,8 @@ menu(void)
       put_number(page+1, 1, 6, 0);
       put_char('/', 7, 0);
       put_number(pages, 1, 8, 0);
+      put_string("IPF:", 12, 0);
+      put_number(ipf, 3, 16, 0);
       for(y = 1; y <= PER_PAGE && i < num_of_roms; y++)
         {
           put_char(idx == i ? '>' : ' ', x-1, y);
@@ -73,7 +77,7 @@ menu(void)
       if(joypad & JOY_I)
         return idx;
 
-      if((joypad & 0xF0) == (prevjoypad & 0xF0))
+      if((joypad & 0xFC) == (prevjoypad & 0xFC))
         continue;
 
       if((joypad & JOY_UP))
@@ -84,6 +88,10 @@ menu(void)
         idx -= PER_PAGE;
       else if(joypad & JOY_RIGHT)
         idx += PER_PAGE;
+      else if(joypad & JOY_RUN)
+        chip8_set_ipf(ipf + ((joypad & JOY_II) ? 10 : 1));
+      else if(joypad & JOY_SEL)
+        chip8_set_ipf(ipf - ((joypad & JOY_II) ? 10 : 1));
 
       if(idx < 0)
         idx = 0;
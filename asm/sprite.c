@@ -22,11 +22,8 @@
    THE SOFTWARE.
 */
 
-static char collision;
+char collision;
 
-static const int  *videoram   = 0x0002;
-static const char *videoram_l = 0x0002;
-static const char *videoram_h = 0x0003;
 const unsigned int yaddr[] =
   {
     0x1000, 0x100F, 0x140E, 0x180D, 0x1C0C, 0x200B, 0x240A, 0x2809,
@@ -35,6 +32,109 @@ const unsigned int yaddr[] =
     0x6400, 0x640F, 0x680E, 0x6C0D, 0x700C, 0x740B, 0x780A, 0x7C09
   };
 
+/*
+  setpixel(addr, val)
+
+  XOR one CHIP-8 pixel (an 8x7 block) at VRAM address addr, setting
+  collision if a lit pixel gets cleared. The new value goes into the
+  low byte latch once and the 7 line writes only touch the high byte.
+  A block starting below line 1 of its tile spills into the tile
+  below so the write address is moved to line 0 of that tile part way
+  through.
+*/
+#pragma fastcall setpixel(word di, byte acc)
+
+#asm
+.code
+_setpixel.2:
+        stx  <_al
+
+        lda  #$01
+        sta  <vdc_reg
+        st0  #$01
+        lda  <_di
+        sta  video_data_l
+        lda  <_di+1
+        sta  video_data_h
+        lda  #$00
+        sta  <vdc_reg
+        st0  #$00
+        lda  <_di
+        sta  video_data_l
+        lda  <_di+1
+        sta  video_data_h
+        lda  #$02
+        sta  <vdc_reg
+        st0  #$02
+
+        lda  video_data_l
+        beq  .was_off
+        lda  <_al
+        beq  .set_on
+        lda  #1
+        sta  _collision
+        bra  .set_off
+.was_off:
+        lda  <_al
+        bne  .set_on
+.set_off:
+        cla
+        bra  .write
+.set_on:
+        lda  #$FF
+.write:
+        sta  <_al
+        sta  video_data_l
+
+        lda  <_di
+        and  #$07
+        cmp  #$02
+        bcs  .split
+        stz  video_data_h
+        stz  video_data_h
+        stz  video_data_h
+        stz  video_data_h
+        stz  video_data_h
+        stz  video_data_h
+        stz  video_data_h
+        rts
+
+.split:
+        eor  #$07
+        inc  A
+        tax
+.top:
+        stz  video_data_h
+        dex
+        bne  .top
+
+        lda  #$00
+        sta  <vdc_reg
+        st0  #$00
+        lda  <_di
+        and  #$F8
+        sta  video_data_l
+        lda  <_di+1
+        clc
+        adc  #$04
+        sta  video_data_h
+        lda  #$02
+        sta  <vdc_reg
+        st0  #$02
+        lda  <_al
+        sta  video_data_l
+
+        lda  <_di
+        and  #$07
+        dec  A
+        tax
+.bottom:
+        stz  video_data_h
+        dex
+        bne  .bottom
+        rts
+#endasm
+
 char
 chip8_put_sprite(char *sprite,
                  char  x,
@@ -63,111 +163,3 @@ chip8_put_sprite(char *sprite,
 
   return collision;
 }
-
-static
-void
-setpixel(const int addr,
-         char      val)
-{
-  static char pixel;
-
-  vreg(0x00);
-  *videoram = addr;
-  vreg(0x01);
-  *videoram = addr;
-  vreg(0x02);
-
-  val   = !!val;
-  pixel = !!*videoram_l;
-
-  collision |= val & pixel;
-  pixel      = val ^ pixel ? 0xFF : 0x00;
-
-  *videoram_l = pixel;
-  switch(addr & 0x07)
-    {
-    default:
-    case 0:
-    case 1:
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      break;
-
-    case 2:
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      vreg(0x00,addr+1022);
-      vreg(0x02);
-      *videoram_h = 0x00;
-      break;
-
-    case 3:
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      vreg(0x00,addr+1021);
-      vreg(0x02);
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      break;
-
-    case 4:
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      vreg(0x00,addr+1020);
-      vreg(0x02);
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      break;
-
-    case 5:
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      vreg(0x00,addr+1019);
-      vreg(0x02);
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      break;
-
-    case 6:
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      vreg(0x00,addr+1018);
-      vreg(0x02);
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      break;
-
-    case 7:
-      *videoram_h = 0x00;
-      vreg(0x00,addr+1017);
-      vreg(0x02);
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      *videoram_h = 0x00;
-      break;
-    }
-}